@@ -44,5 +44,13 @@ if("${DNNL_CPU_THREADING_RUNTIME}" STREQUAL "THREADPOOL")
         message(STATUS "Threadpool testing: standalone")
     endif()
 
+    if("${_DNNL_TEST_THREADPOOL_IMPL}" STREQUAL "NATIVE")
+        message(STATUS "Threadpool testing: native")
+    endif()
+
+    if(DNNL_CPU_NATIVE_THREADPOOL)
+        add_definitions(-DDNNL_CPU_NATIVE_THREADPOOL)
+    endif()
+
     add_definitions(-DDNNL_TEST_THREADPOOL_USE_${_DNNL_TEST_THREADPOOL_IMPL})
 endif()
@@ -124,7 +124,7 @@ set(DNNL_ENABLE_PRIMITIVE "ALL" CACHE STRING
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
       DECONVOLUTION, ELTWISE, GROUP_NORMALIZATION, INNER_PRODUCT,
       LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU, REDUCTION, REORDER,
-      RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM.
+      RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM, TOPK.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
@@ -249,24 +249,35 @@ option(DNNL_ENABLE_ITT_TASKS
 
 set(DNNL_CPU_RUNTIME "OMP" CACHE STRING
     "specifies the threading runtime for CPU engines;
-    supports OMP (default), TBB or SYCL (SYCL CPU engines).
+    supports OMP (default), TBB, NATIVE (built-in work-stealing threadpool)
+    or SYCL (SYCL CPU engines).
 
     To use Threading Building Blocks (TBB) one should also
     set TBBROOT (either environment variable or CMake option) to the library
     location.")
-if(NOT "${DNNL_CPU_RUNTIME}" MATCHES "^(NONE|OMP|TBB|SEQ|THREADPOOL|DPCPP|SYCL)$")
+if(NOT "${DNNL_CPU_RUNTIME}" MATCHES "^(NONE|OMP|TBB|SEQ|THREADPOOL|NATIVE|DPCPP|SYCL)$")
     message(FATAL_ERROR "Unsupported CPU runtime: ${DNNL_CPU_RUNTIME}")
 endif()
 
 set(_DNNL_TEST_THREADPOOL_IMPL "STANDALONE" CACHE STRING
     "specifies which threadpool implementation to use when
     DNNL_CPU_RUNTIME=THREADPOOL is selected. Valid values: STANDALONE, EIGEN,
-    TBB")
-if(NOT "${_DNNL_TEST_THREADPOOL_IMPL}" MATCHES "^(STANDALONE|TBB|EIGEN)$")
+    TBB. DNNL_CPU_RUNTIME=NATIVE always uses NATIVE.")
+if(NOT "${_DNNL_TEST_THREADPOOL_IMPL}" MATCHES "^(STANDALONE|TBB|EIGEN|NATIVE)$")
     message(FATAL_ERROR
         "Unsupported threadpool implementation: ${_DNNL_TEST_THREADPOOL_IMPL}")
 endif()
 
+# NATIVE is the threadpool runtime with a library-provided default threadpool.
+# Streams created without a user threadpool run on that pool, and the tests
+# use the same implementation.
+set(DNNL_CPU_NATIVE_THREADPOOL OFF)
+if(DNNL_CPU_RUNTIME STREQUAL "NATIVE")
+    set(DNNL_CPU_RUNTIME "THREADPOOL")
+    set(DNNL_CPU_NATIVE_THREADPOOL ON)
+    set(_DNNL_TEST_THREADPOOL_IMPL "NATIVE")
+endif()
+
 set(TBBROOT "" CACHE STRING
     "path to Thread Building Blocks (TBB).
     Use this option to specify TBB installation locaton.")
@@ -182,6 +182,63 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
         dnnl_primitive_t *primitive, const_dnnl_primitive_desc_t primitive_desc,
         size_t size, const uint8_t *cache_blob);
 
+/// Starts an asynchronous creation of a primitive.
+///
+/// The primitive is created by one of a few library worker threads and the
+/// function returns without waiting for the creation to complete. The worker
+/// uses the threading context of the calling thread: the maximum number of
+/// threads and, with the threadpool runtime, the active threadpool. The
+/// creation goes through the primitive cache: if the same primitive is being
+/// created by another thread, the request waits for that creation instead of
+/// repeating it.
+///
+/// @note
+///     The primitive descriptor is copied, so it can be destroyed right after
+///     the call. The engine of the primitive descriptor and, with the
+///     threadpool runtime, the threadpool active at the call must outlive the
+///     request.
+///
+/// @param request Output asynchronous creation request.
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        dnnl_primitive_create_request_t *request,
+        const_dnnl_primitive_desc_t primitive_desc);
+
+/// Checks whether an asynchronous primitive creation has completed.
+///
+/// @param request Asynchronous creation request.
+/// @param is_ready Output value: 1 if the creation has completed (either
+///     successfully or not) and 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_request_is_ready(
+        const_dnnl_primitive_create_request_t request, int *is_ready);
+
+/// Waits for an asynchronous primitive creation to complete and returns the
+/// created primitive.
+///
+/// The function can be called multiple times. Each successful call returns a
+/// new handle to the same primitive that must be destroyed with
+/// dnnl_primitive_destroy().
+///
+/// @param request Asynchronous creation request.
+/// @param primitive Output primitive.
+/// @returns The status of the primitive creation.
+dnnl_status_t DNNL_API dnnl_primitive_create_request_get(
+        const_dnnl_primitive_create_request_t request,
+        dnnl_primitive_t *primitive);
+
+/// Destroys an asynchronous primitive creation request. Waits for the
+/// creation to complete if it is still in progress.
+///
+/// @param request Asynchronous creation request to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_request_destroy(
+        dnnl_primitive_create_request_t request);
+
 /// Executes a primitive.
 ///
 /// @param primitive Primitive to execute.
@@ -3612,6 +3669,38 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk Top-k
+/// @{
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// @note
+///     Destination and indices memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Top-k algorithm kind. Possible values: #dnnl_topk_max,
+///     #dnnl_topk_min.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor. The number of selected
+///     elements k is the size of its @p axis dimension.
+/// @param indices_desc Indices memory descriptor. Must have the same
+///     dimensions as @p dst_desc.
+/// @param axis Axis along which the elements are selected.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_topk
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3640,6 +3729,56 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the total size in bytes of the primitives that can be held in the
+/// primitive cache at the same time.
+///
+/// @param capacity Primitive cache capacity in bytes to query. Zero means
+///     that the size of the primitives is not limited. Concurrently
+///     accessing @p capacity is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity_in_bytes(
+        size_t *capacity);
+
+/// Sets the total size in bytes of the primitives that can be held in the
+/// primitive cache at a time.
+///
+/// The size of a primitive accounts for the memory the primitive holds while
+/// it resides in the cache, such as JIT-generated code. The limit applies in
+/// addition to the capacity set with dnnl_set_primitive_cache_capacity().
+///
+/// @param capacity Primitive cache capacity in bytes to set. If the total size
+///     of the cached primitives exceeds the new @p capacity then the least
+///     recently used primitives will be evicted. Setting the @p capacity to 0
+///     removes the limit. Concurrently modifying @p capacity is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity_in_bytes(
+        size_t capacity);
+
+/// Fills the primitive cache with the primitives listed in a manifest.
+///
+/// The manifest is recorded by the library when the
+/// `ONEDNN_PRIMITIVE_CACHE_RECORD` environment variable is set to a file path:
+/// every primitive created on a primitive cache miss is appended to the file.
+/// Replaying the manifest at application start-up moves primitive creation
+/// cost out of the first iterations of the workload.
+///
+/// @note
+///     Records that were made for a different engine kind or by a different
+///     library version are skipped, as are records whose implementation is
+///     not available on the current machine and corrupted records.
+///
+/// @param engine Engine to create the primitives on.
+/// @param path Path to the manifest file.
+/// @param n_created Output number of the created primitives (can be NULL).
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     manifest cannot be read, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_primitive_cache_warmup(
+        dnnl_engine_t engine, const char *path, int *n_created);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -4014,6 +4153,339 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a batch of single-precision matrix-matrix multiplies.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// for `i` in `[0, batch)`, where all the problems share the parameters
+/// described in dnnl_sgemm(). The whole batch is scheduled across threads at
+/// once, which is faster than calling dnnl_sgemm() in a loop when the matrices
+/// are small.
+///
+/// @note
+///     The `C[i]` matrices must not overlap.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const float *const *A, dnnl_dim_t lda, const float *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch);
+
+/// Performs a batch of single-precision matrix-matrix multiplies on matrices
+/// located at a constant distance from each other.
+///
+/// Same as dnnl_sgemm_batch() with `A[i] = A + i * stride_a`,
+/// `B[i] = B + i * stride_b`, and `C[i] = C + i * stride_c`. A zero stride
+/// makes all the problems share the matrix.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param batch The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_strided_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha * (op(A[i]) - A_offset) * (op(B[i]) - B_offset)
+///         + beta * C[i] + C_offset`
+///
+/// for `i` in `[0, batch)`, where all the problems share the parameters
+/// described in dnnl_gemm_u8s8s32(), including the offsets. The whole batch is
+/// scheduled across threads at once, which is faster than calling
+/// dnnl_gemm_u8s8s32() in a loop when the matrices are small.
+///
+/// @note
+///     The `C[i]` matrices must not overlap.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C, see dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of offset values for the matrices C. The number of
+///     elements in the array depends on the value of @p offsetc.
+/// @param batch The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on matrices located
+/// at a constant distance from each other.
+///
+/// Same as dnnl_gemm_u8s8s32_batch() with `A[i] = A + i * stride_a`,
+/// `B[i] = B + i * stride_b`, and `C[i] = C + i * stride_c`. A zero stride
+/// makes all the problems share the matrix.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C, see dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param co An array of offset values for the matrices C. The number of
+///     elements in the array depends on the value of @p offsetc.
+/// @param batch The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_strided_batch(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch);
+
+/// Returns the size in bytes of a buffer for a matrix packed by
+/// dnnl_sgemm_pack().
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for matrix A, and 'B' or 'b'
+///     for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix of a single-precision matrix-matrix multiply into an
+/// internal format, which makes dnnl_sgemm_compute() skip copying the matrix
+/// on every call. This is useful when the same matrix, for example constant
+/// weights, is multiplied many times.
+///
+/// The packed buffer records the packing parameters, the library version, and
+/// the CPU ISA. It can be used only with the same library version on the
+/// same CPU ISA, and dnnl_sgemm_compute() returns #dnnl_invalid_arguments for
+/// a buffer that does not match.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for matrix A, and 'B' or 'b'
+///     for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_sgemm_pack_get_size(). The buffer must be aligned to 64 bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst);
+
+/// Performs single-precision matrix-matrix multiply with matrices that may be
+/// packed by dnnl_sgemm_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// where the parameters have the same meaning as in dnnl_sgemm().
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the matrix A data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A. Ignored if A is packed.
+/// @param B A pointer to the matrix B data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Returns the size in bytes of a buffer for a matrix packed by
+/// dnnl_gemm_u8s8s32_pack().
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the 8-bit unsigned
+///     matrix A, and 'B' or 'b' for the 8-bit signed matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix of an integer matrix-matrix multiply into an internal
+/// format, which makes dnnl_gemm_u8s8s32_compute() skip copying the matrix on
+/// every call.
+///
+/// The packed buffer has the same compatibility restrictions as the one of
+/// dnnl_sgemm_pack().
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the 8-bit unsigned
+///     matrix A, and 'B' or 'b' for the 8-bit signed matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_u8s8s32_pack_get_size(). The buffer must be aligned to 64
+///     bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on an 8-bit unsigned matrix A and
+/// an 8-bit signed matrix B that may be packed by dnnl_gemm_u8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// where the parameters have the same meaning as in dnnl_gemm_u8s8s32().
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C,
+///     see dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the matrix A data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A. Ignored if A is packed.
+/// @param B A pointer to the matrix B data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @param co An array of offset values for the matrix C. The number of
+///     elements in the array depends on the value of @p offsetc.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -88,6 +88,13 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_primitive_create_request_t> {
+    static dnnl_status_t destructor(dnnl_primitive_create_request_t p) {
+        return dnnl_primitive_create_request_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -151,6 +158,8 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// A top-k primitive.
+        topk = dnnl_topk,
     };
 
     using handle::handle;
@@ -501,6 +510,10 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Top-k selecting the largest values
+    topk_max = dnnl_topk_max,
+    /// Top-k selecting the smallest values
+    topk_min = dnnl_topk_min,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -5395,6 +5408,49 @@ struct primitive_desc : public primitive_desc_base {
     }
 };
 
+/// A handle of a primitive that is being created asynchronously.
+///
+/// @sa dnnl_primitive_create_async()
+struct primitive_create_request
+    : public handle<dnnl_primitive_create_request_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    primitive_create_request() = default;
+
+    /// Starts an asynchronous creation of a primitive.
+    ///
+    /// @param pd Primitive descriptor.
+    primitive_create_request(const primitive_desc_base &pd) {
+        dnnl_primitive_create_request_t result;
+        error::wrap_c_api(dnnl_primitive_create_async(&result, pd.get()),
+                "could not start an asynchronous primitive creation");
+        reset(result);
+    }
+
+    /// Returns whether the creation has completed.
+    ///
+    /// @returns @c true if the creation has completed (either successfully
+    ///     or not) and @c false otherwise.
+    bool is_ready() const {
+        int result = 0;
+        error::wrap_c_api(
+                dnnl_primitive_create_request_is_ready(get(), &result),
+                "could not query an asynchronous primitive creation");
+        return result != 0;
+    }
+
+    /// Waits for the creation to complete and returns the created primitive.
+    ///
+    /// @returns The created primitive.
+    primitive get_primitive() const {
+        dnnl_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_create_request_get(get(), &result),
+                "could not create a primitive");
+        return primitive(result);
+    }
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_convolution Convolution
@@ -13712,6 +13768,102 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk Top-k
+///
+/// A primitive to select the k largest or smallest elements of a tensor
+/// along an axis and their indices.
+///
+/// @sa @ref dev_guide_topk in developer guide
+///
+/// @{
+
+/// Top-k.
+struct topk : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a top-k primitive.
+        ///
+        /// @note
+        ///     Destination and indices memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Top-k algorithm kind. Possible values:
+        ///     #dnnl_topk_max, #dnnl_topk_min.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor. The number of
+        ///     selected elements k is the size of its @p axis dimension.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param axis Axis along which the elements are selected.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &indices_desc, int axis,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    dst_desc.get(), indices_desc.get(), axis, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the top-k primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a top-k primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a top-k primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::topk) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::dst_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    topk(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a top-k primitive from a cache blob.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    /// @param cache_blob Cache blob.
+    topk(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_topk
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13932,6 +14084,36 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Returns the total size in bytes of the primitives that can be held in the
+/// primitive cache at the same time.
+inline size_t get_primitive_cache_capacity_in_bytes() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_capacity_in_bytes(&result),
+            "could not get primitive cache capacity in bytes");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_capacity_in_bytes(size_t capacity)
+inline void set_primitive_cache_capacity_in_bytes(size_t capacity) {
+    error::wrap_c_api(dnnl_set_primitive_cache_capacity_in_bytes(capacity),
+            "could not set primitive cache capacity in bytes");
+}
+
+/// Fills the primitive cache with the primitives listed in a manifest.
+///
+/// @sa dnnl_primitive_cache_warmup()
+///
+/// @param aengine Engine to create the primitives on.
+/// @param path Path to the manifest file.
+/// @returns The number of the created primitives.
+inline int primitive_cache_warmup(const engine &aengine, const char *path) {
+    int result = 0;
+    error::wrap_c_api(
+            dnnl_primitive_cache_warmup(aengine.get(), path, &result),
+            "could not warm up primitive cache");
+    return result;
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -13967,6 +14149,98 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        dnnl_dim_t lda, const float *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, batch));
+}
+
+/// @copydoc dnnl_sgemm_strided_batch()
+inline status sgemm_strided_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A, dnnl_dim_t lda,
+        dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_sgemm_strided_batch(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co, batch));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_strided_batch()
+inline status gemm_u8s8s32_strided_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_strided_batch(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b, bo,
+            beta, C, ldc, stride_c, co, batch));
+}
+
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
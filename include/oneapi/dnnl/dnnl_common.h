@@ -94,6 +94,59 @@ dnnl_status_t DNNL_API dnnl_stream_create(
 dnnl_status_t DNNL_API dnnl_stream_get_engine(
         const_dnnl_stream_t stream, dnnl_engine_t *engine);
 
+/// Sets the thread budget of a CPU stream: the number of threads used by
+/// primitives executed on the stream. With OpenMP threading, a stream with a
+/// budget can execute primitives from inside an application parallel region
+/// using a nested team of @p max_threads threads, provided nested parallelism
+/// is enabled (see omp_set_max_active_levels()). This allows running several
+/// primitives side by side on disjoint sets of cores.
+///
+/// Primitives should be created with the same number of threads available,
+/// as their work decomposition is chosen at creation time, for example with
+/// the same thread budget set for the creating thread (see
+/// dnnl_set_thread_budget()).
+///
+/// @param stream Execution stream.
+/// @param max_threads Number of threads. 0 (default) means that the stream
+///     uses the threading runtime defaults.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_max_threads(
+        dnnl_stream_t stream, int max_threads);
+
+/// Returns the thread budget of a CPU stream.
+///
+/// @param stream Execution stream.
+/// @param max_threads Output number of threads, 0 if the stream has no
+///     budget.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_max_threads(
+        const_dnnl_stream_t stream, int *max_threads);
+
+/// Sets the thread budget of the calling thread: the number of threads used
+/// by CPU primitive descriptor and primitive creation and by CPU primitive
+/// executions on streams without a budget of their own. Setting the same
+/// budget for creation and execution lets primitives choose their work
+/// decomposition for the number of threads they are executed with.
+///
+/// With OpenMP threading, the budget applies at the nesting level it was set
+/// at, for example inside an application parallel region.
+///
+/// @param max_threads Number of threads. 0 (default) means that the thread
+///     uses the threading runtime defaults.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_set_thread_budget(int max_threads);
+
+/// Returns the thread budget of the calling thread.
+///
+/// @param max_threads Output number of threads, 0 if the thread has no
+///     budget.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_get_thread_budget(int *max_threads);
+
 /// Waits for all primitives in the execution stream to finish computations.
 ///
 /// @param stream Execution stream.
@@ -362,6 +362,27 @@ struct stream : public handle<dnnl_stream_t> {
         return engine(c_engine, true);
     }
 
+    /// Sets the number of threads used by primitives executed on the stream.
+    /// See dnnl_stream_set_max_threads() for details.
+    ///
+    /// @param max_threads Number of threads, 0 to use the threading runtime
+    ///     defaults.
+    /// @returns The stream itself.
+    stream &set_max_threads(int max_threads) {
+        error::wrap_c_api(dnnl_stream_set_max_threads(get(), max_threads),
+                "could not set a thread budget for a stream");
+        return *this;
+    }
+
+    /// Returns the number of threads used by primitives executed on the
+    /// stream, 0 if the stream uses the threading runtime defaults.
+    int get_max_threads() const {
+        int max_threads = 0;
+        error::wrap_c_api(dnnl_stream_get_max_threads(get(), &max_threads),
+                "could not get a thread budget of a stream");
+        return max_threads;
+    }
+
     /// Waits for all primitives executing in the stream to finish.
     /// @returns The stream itself.
     stream &wait() {
@@ -413,6 +434,25 @@ struct stream : public handle<dnnl_stream_t> {
 
 DNNL_DEFINE_BITMASK_OPS(stream::flags)
 
+/// Sets the thread budget of the calling thread. See dnnl_set_thread_budget()
+/// for details.
+///
+/// @param max_threads Number of threads, 0 to use the threading runtime
+///     defaults.
+inline void set_thread_budget(int max_threads) {
+    error::wrap_c_api(dnnl_set_thread_budget(max_threads),
+            "could not set a thread budget");
+}
+
+/// Returns the thread budget of the calling thread, 0 if the thread uses the
+/// threading runtime defaults.
+inline int get_thread_budget() {
+    int max_threads = 0;
+    error::wrap_c_api(dnnl_get_thread_budget(&max_threads),
+            "could not get a thread budget");
+    return max_threads;
+}
+
 /// @} dnnl_api_stream
 
 /// @addtogroup dnnl_api_fpmath_mode Floating-point Math Mode
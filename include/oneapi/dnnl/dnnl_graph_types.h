@@ -261,6 +261,9 @@ typedef enum {
     dnnl_graph_op_group_norm,
     dnnl_graph_op_gen_index,
     dnnl_graph_op_greater_equal,
+    dnnl_graph_op_paged_cache_load,
+    dnnl_graph_op_rms_norm,
+    dnnl_graph_op_rope,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
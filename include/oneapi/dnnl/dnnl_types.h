@@ -2050,6 +2050,8 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// A top-k primitive.
+    dnnl_topk,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_primitive_kind_max = 0x7fff,
@@ -2207,6 +2209,10 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Top-k selecting the largest values
+    dnnl_topk_max = 0x40000,
+    /// Top-k selecting the smallest values
+    dnnl_topk_min,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2474,6 +2480,15 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_primitive_create_request
+/// An opaque structure to describe an asynchronous primitive creation.
+struct dnnl_primitive_create_request;
+/// An asynchronous primitive creation handle.
+typedef struct dnnl_primitive_create_request *dnnl_primitive_create_request_t;
+/// A constant asynchronous primitive creation handle.
+typedef const struct dnnl_primitive_create_request
+        *const_dnnl_primitive_create_request_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -2522,6 +2537,9 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input recurrent hidden state vector. An
 /// alias for #DNNL_ARG_DST_1.
 #define DNNL_ARG_DST_ITER DNNL_ARG_DST_1
+/// A special mnemonic for top-k output indices. An alias for
+/// #DNNL_ARG_DST_1.
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
 
 /// Destination argument #2.
 #define DNNL_ARG_DST_2 19
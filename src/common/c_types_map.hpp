@@ -25,6 +25,7 @@
 // to give names that better reflects the meaning of the entities
 using primitive_iface_t = dnnl_primitive;
 using primitive_desc_iface_t = dnnl_primitive_desc;
+using primitive_create_request_t = dnnl_primitive_create_request;
 
 namespace dnnl {
 namespace impl {
@@ -142,6 +143,8 @@ const alg_kind_t reduction_norm_lp_power_p_max
         = dnnl_reduction_norm_lp_power_p_max;
 const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t topk_max = dnnl_topk_max;
+const alg_kind_t topk_min = dnnl_topk_min;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
 // Internal only alg kinds.
@@ -1980,6 +1983,7 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t topk = dnnl_topk;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -2143,6 +2147,7 @@ struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
@@ -18,6 +18,7 @@
 #define COMMON_CACHE_HIT_TYPES_HPP
 
 #include <cassert>
+#include <cstddef>
 #include <string>
 
 namespace dnnl {
@@ -47,6 +48,14 @@ inline const char *cache_state2str(const cache_state_t cache_hit) {
     return "";
 }
 
+// Counters describing the cache behavior, used for testing and profiling.
+struct cache_stats_t {
+    size_t hits = 0;
+    size_t misses = 0;
+    // The number of times a write lock could not be acquired immediately.
+    size_t contended_locks = 0;
+};
+
 } // namespace impl
 } // namespace dnnl
 
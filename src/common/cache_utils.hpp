@@ -22,6 +22,7 @@
 #include <memory>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
@@ -35,6 +36,7 @@
 #include <windows.h>
 #endif
 
+#include "cache_hit_types.hpp"
 #include "rw_mutex.hpp"
 
 namespace dnnl {
@@ -47,6 +49,11 @@ namespace utils {
 template <typename K, typename O>
 using key_merge_t = void (*)(const K &, const O &);
 
+// Returns the amount of memory in bytes held by the object o. This is used to
+// limit the total size of the cached objects.
+template <typename O>
+using object_size_t = size_t (*)(const O &);
+
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct cache_t {
@@ -115,38 +122,51 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy.
+//
+// The entries are distributed between `nshards` independent shards according
+// to the key hash. Each shard has its own lock, so lookups and insertions of
+// keys that belong to different shards do not block each other. The capacity
+// limits the total number of entries in all shards. When it is exceeded, the
+// least recently used entry among all shards is evicted.
+//
+// If `object_size` is provided, the cache can additionally limit the total
+// size of the cached objects in bytes.
 template <typename K, typename O, typename C,
-        key_merge_t<K, O> key_merge = nullptr>
+        key_merge_t<K, O> key_merge = nullptr,
+        object_size_t<O> object_size = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using lru_base_t = cache_t<K, O, C, key_merge>;
     using key_t = typename lru_base_t::key_t;
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    lru_cache_t(int capacity, int nshards = 1)
+        : capacity_(capacity)
+        , capacity_in_bytes_(0)
+        , size_(0)
+        , size_in_bytes_(0)
+        , shards_(std::max(nshards, 1)) {}
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        if (get_size() == 0) return;
 
         if (!is_destroying_cache_safe()) {
-            // It is safe to remove those entries that are not affected by the
-            // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &shard : shards_) {
+                // It is safe to remove those entries that are not affected by
+                // the unloading order issue e.g. native CPU.
+                for (auto it = shard.cache_mapper_.begin();
+                        it != shard.cache_mapper_.end();) {
+                    if (!it->first.has_runtime_dependencies()) {
+                        it = shard.cache_mapper_.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
+                shard.release_cache();
             }
-            release_cache();
             return;
         }
     }
@@ -154,90 +174,121 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     cache_object_t get(const key_t &key) override {
         value_t e;
         {
-            utils::lock_read_t lock_r(this->rw_mutex());
             if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            auto &shard = get_shard(key);
+            utils::lock_read_t lock_r(shard.rw_mutex_);
+            e = shard.get_future(key);
         }
 
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    };
+    int get_capacity() const override { return capacity_; };
 
     status_t set_capacity(int capacity) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
         capacity_ = capacity;
-        // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
-            // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
-            evict(n_excess_entries);
+        if (capacity_ == 0) {
+            for (auto &shard : shards_) {
+                utils::lock_write_t lock_w(shard.rw_mutex_);
+                while (!shard.cache_mapper_.empty())
+                    erase(shard, shard.cache_mapper_.begin());
+            }
+            return status::success;
         }
+        // Evict excess entries if number of entries exceeds the new capacity
+        evict_excess();
         return status::success;
     }
-    void set_capacity_without_clearing(int capacity) {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+    void set_capacity_without_clearing(int capacity) { capacity_ = capacity; }
+
+    // Zero means that the total size of the cached objects is not limited.
+    size_t get_capacity_in_bytes() const { return capacity_in_bytes_; }
+
+    status_t set_capacity_in_bytes(size_t capacity_in_bytes) {
+        if ((void *)object_size == nullptr) return status::unimplemented;
+        capacity_in_bytes_ = capacity_in_bytes;
+        evict_excess();
+        return status::success;
     }
 
-    int get_size() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+    int get_size() const override { return size_; }
+    size_t get_size_in_bytes() const { return size_in_bytes_; }
+
+    cache_stats_t get_stats() const {
+        cache_stats_t stats;
+        for (const auto &shard : shards_) {
+            stats.hits += shard.n_hits_;
+            stats.misses += shard.n_misses_;
+            stats.contended_locks += shard.n_contended_locks_;
+        }
+        return stats;
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
-
     value_t get_or_add(const key_t &key, const value_t &value) override {
+        // Check if the cache is enabled.
+        if (capacity_ == 0) { return value_t(); }
+
+        auto &shard = get_shard(key);
         {
             // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
-            // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
+            utils::lock_read_t lock_r(shard.rw_mutex_);
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
-            auto e = get_future(key);
-            if (e.valid()) { return e; }
+            auto e = shard.get_future(key);
+            if (e.valid()) {
+                shard.n_hits_.fetch_add(1, std::memory_order_relaxed);
+                return e;
+            }
         }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
-        // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
+        {
+            utils::lock_write_t lock_w(
+                    shard.rw_mutex_, shard.n_contended_locks_);
+            // 2. Section with exclusive access (write lock).
+            // In a multithreaded scenario, in the context of one thread the
+            // shard may have changed by another thread between releasing the
+            // read lock and acquiring the write lock (a.k.a. ABA problem),
+            // therefore additional checks have to be performed for
+            // correctness. Double check the capacity due to possible race
+            // condition
+            if (capacity_ == 0) { return value_t(); }
 
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
-        if (!e.valid()) {
+            // Double check if the requested entry is present in the cache
+            // (unlikely cache_hit).
+            auto e = shard.get_future(key);
+            if (e.valid()) {
+                shard.n_hits_.fetch_add(1, std::memory_order_relaxed);
+                return e;
+            }
             // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+            shard.add(key, value, get_timestamp());
+            shard.n_misses_.fetch_add(1, std::memory_order_relaxed);
+            size_++;
         }
-        return e;
+        // The eviction takes the locks of other shards, so it happens only
+        // after the lock of the current shard is released.
+        evict_excess();
+        return value_t();
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
-
         if (capacity_ == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto &shard = get_shard(key);
+        utils::lock_write_t lock_w(shard.rw_mutex_, shard.n_contended_locks_);
+
+        auto it = shard.cache_mapper_.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == shard.cache_mapper_.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        erase(shard, it);
     }
 
 private:
@@ -253,49 +304,129 @@ private:
         // Cast to void as compilers may warn about comparing compile time
         // constant function pointers with nullptr, as that is often not an
         // intended behavior
-        if ((void *)key_merge == nullptr) return;
-
-        utils::lock_write_t lock_w(this->rw_mutex());
+        if ((void *)key_merge == nullptr && (void *)object_size == nullptr)
+            return;
 
         if (capacity_ == 0) { return; }
 
-        // There is nothing to do in two cases:
-        // 1. The requested entry is not in the cache because it has been evicted
-        //    by another thread
-        // 2. After the requested entry had been evicted it was inserted again
-        //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
-                || it->first.thread_id() != key.thread_id()) {
-            return;
+        {
+            auto &shard = get_shard(key);
+            utils::lock_write_t lock_w(
+                    shard.rw_mutex_, shard.n_contended_locks_);
+
+            // There is nothing to do in two cases:
+            // 1. The requested entry is not in the cache because it has been
+            //    evicted by another thread
+            // 2. After the requested entry had been evicted it was inserted
+            //    again by another thread
+            auto it = shard.cache_mapper_.find(key);
+            if (it == shard.cache_mapper_.end()
+                    || it->first.thread_id() != key.thread_id()) {
+                return;
+            }
+
+            if ((void *)key_merge != nullptr) key_merge(it->first, p);
+            if ((void *)object_size != nullptr) {
+                // An entry may be updated more than once, e.g. when a
+                // primitive is re-created, so the previous size is replaced.
+                const size_t new_size = object_size(p);
+                size_in_bytes_ -= it->second.size_;
+                size_in_bytes_ += new_size;
+                it->second.size_ = new_size;
+            }
         }
+        // The size of the object is known only once it is created.
+        if (capacity_in_bytes_ != 0) evict_excess();
+    }
+
+    bool is_over_capacity() const {
+        return size_ > capacity_
+                || (capacity_in_bytes_ != 0
+                        && size_in_bytes_ > capacity_in_bytes_);
+    }
 
-        key_merge(it->first, p);
+    // Evicts the least recently used entries until the number of entries and
+    // their total size fit the capacity. Shards are inspected one at a time,
+    // hence no thread ever holds more than one shard lock.
+    void evict_excess() {
+        while (is_over_capacity()) {
+            // Find the shard with the smallest timestamp
+            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
+            // maybe evict multiple entries at once.
+            shard_t *victim = nullptr;
+            size_t min_timestamp = 0;
+            for (auto &shard : shards_) {
+                utils::lock_read_t lock_r(shard.rw_mutex_);
+                auto it = shard.find_lru();
+                if (it == shard.cache_mapper_.end()) continue;
+                const size_t timestamp
+                        = it->second.timestamp_.load(std::memory_order_relaxed);
+                if (!victim || timestamp < min_timestamp) {
+                    victim = &shard;
+                    min_timestamp = timestamp;
+                }
+            }
+            if (!victim) return;
+
+            utils::lock_write_t lock_w(
+                    victim->rw_mutex_, victim->n_contended_locks_);
+            // Another thread may have evicted entries in the meantime.
+            if (!is_over_capacity()) return;
+            auto it = victim->find_lru();
+            if (it == victim->cache_mapper_.end()) continue;
+            erase(*victim, it);
+        }
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    struct timed_entry_t {
+        value_t value_;
+        std::atomic<size_t> timestamp_;
+        // The size of the object in bytes, it is set once the object is
+        // created.
+        size_t size_ = 0;
+        timed_entry_t(const value_t &value, size_t timestamp)
+            : value_(value), timestamp_(timestamp) {}
+    };
 
-        if (n == capacity_) {
-            cache_mapper().clear();
-            return;
+    // Each entry in the cache has a corresponding key and timestamp. NOTE:
+    // pairs that contain atomics cannot be stored in an unordered_map *as an
+    // element*, since it invokes the copy constructor of std::atomic, which is
+    // deleted.
+    using cache_mapper_t = std::unordered_map<key_t, timed_entry_t>;
+
+    struct shard_t {
+        // Must be called under a lock.
+        value_t get_future(const key_t &key) {
+            auto it = cache_mapper_.find(key);
+            if (it == cache_mapper_.end()) return value_t();
+
+            size_t timestamp = get_timestamp();
+            it->second.timestamp_.store(timestamp);
+            // Return the entry
+            return it->second.value_;
         }
 
-        for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
+        // Must be called under a write lock.
+        void add(const key_t &key, const value_t &value, size_t timestamp) {
+            auto res = cache_mapper_.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(key),
+                    std::forward_as_tuple(value, timestamp));
+            MAYBE_UNUSED(res);
+            assert(res.second);
+        }
+
+        // Must be called under a lock.
+        typename cache_mapper_t::iterator find_lru() {
+            using v_t = typename cache_mapper_t::value_type;
+            return std::min_element(cache_mapper_.begin(), cache_mapper_.end(),
                     [&](const v_t &left, const v_t &right) {
                         // By default, load() and operator T use sequentially
                         // consistent memory ordering, which enforces writing
                         // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
+                        // they are read from the CPU cache line. Since the
+                        // order is not important for picking a candidate for
+                        // eviction, we can safely use the weakest memory
+                        // ordering (relaxed). This brings about a few
                         // microseconds performance improvement for default
                         // cache capacity.
                         return left.second.timestamp_.load(
@@ -303,65 +434,40 @@ private:
                                 < right.second.timestamp_.load(
                                         std::memory_order_relaxed);
                     });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
-        }
-    }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
-            evict(1);
         }
 
-        size_t timestamp = get_timestamp();
-
-        auto res = cache_mapper().emplace(std::piecewise_construct,
-                std::forward_as_tuple(key),
-                std::forward_as_tuple(value, timestamp));
-        MAYBE_UNUSED(res);
-        assert(res.second);
-    }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
-
-        size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
-        // Return the entry
-        return it->second.value_;
-    }
+        // Leaks cached resources. Used to avoid issues with calling destructors
+        // allocated by an already unloaded dynamic library.
+        void release_cache() {
+            auto t = utils::make_unique<cache_mapper_t>();
+            std::swap(*t, cache_mapper_);
+            t.release();
+        }
 
-    int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        utils::rw_mutex_t rw_mutex_;
+        cache_mapper_t cache_mapper_;
+        std::atomic<size_t> n_hits_ {0};
+        std::atomic<size_t> n_misses_ {0};
+        std::atomic<size_t> n_contended_locks_ {0};
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
+    shard_t &get_shard(const key_t &key) {
+        if (shards_.size() == 1) return shards_[0];
+        return shards_[std::hash<key_t>()(key) % shards_.size()];
     }
 
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
+    // Must be called under the shard write lock.
+    void erase(shard_t &shard, typename cache_mapper_t::iterator it) {
+        size_in_bytes_ -= it->second.size_;
+        shard.cache_mapper_.erase(it);
+        size_--;
     }
 
-    // Leaks cached resources. Used to avoid issues with calling destructors
-    // allocated by an already unloaded dynamic library.
-    void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
-    }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+    std::atomic<int> capacity_;
+    std::atomic<size_t> capacity_in_bytes_;
+    std::atomic<int> size_;
+    std::atomic<size_t> size_in_bytes_;
+    std::vector<shard_t> shards_;
 };
 
 } // namespace utils
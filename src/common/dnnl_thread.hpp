@@ -52,6 +52,83 @@
 #include "common/ittnotify.hpp"
 #endif
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include "omp.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+
+// Thread budget of the calling thread: the number of threads parallel sections
+// started by this thread use by default, 0 means no budget. The budget is set
+// by the user for the calling thread (see dnnl_set_thread_budget()), so it
+// also applies to primitive descriptor and primitive creation, and CPU streams
+// override it for the duration of a primitive execution (see
+// dnnl_stream_set_max_threads()). With OpenMP, a budget also lets a primitive
+// executed from inside an application parallel region open a nested team of
+// that size instead of running sequentially, so that several application
+// threads can execute primitives side by side on disjoint sets of cores.
+struct thread_budget_t {
+    int max_threads = 0;
+    // OpenMP nesting level the budget was set at. Parallel sections opened by
+    // the library are one level deeper and do not inherit the budget.
+    int level = 0;
+    // The budget of the thread saved while a stream budget is applied, and the
+    // nesting depth of stream executions on the thread.
+    int saved_max_threads = 0;
+    int saved_level = 0;
+    int stream_depth = 0;
+};
+
+inline thread_budget_t &thread_budget() {
+    static thread_local thread_budget_t budget;
+    return budget;
+}
+
+inline void set_thread_budget(int max_threads) {
+    thread_budget_t &b = thread_budget();
+    b.max_threads = max_threads;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    b.level = omp_get_level();
+#endif
+}
+
+// Applies the budget of a stream for the duration of an execution. A stream
+// without a budget keeps the budget of the thread. Nested executions, e.g.
+// primitives executed by a graph kernel, keep the outermost budget.
+inline void apply_stream_thread_budget(int max_threads) {
+    thread_budget_t &b = thread_budget();
+    if (b.stream_depth++ > 0) return;
+    b.saved_max_threads = b.max_threads;
+    b.saved_level = b.level;
+    if (max_threads > 0) set_thread_budget(max_threads);
+}
+
+// Restores the budget of the thread once the outermost execution completes.
+inline void restore_thread_budget() {
+    thread_budget_t &b = thread_budget();
+    if (b.stream_depth == 0 || --b.stream_depth > 0) return;
+    b.max_threads = b.saved_max_threads;
+    b.level = b.saved_level;
+}
+
+// Returns the budget applicable to the calling thread or 0 if there is none.
+inline int get_thread_budget() {
+    const thread_budget_t &b = thread_budget();
+    if (b.max_threads <= 0) return 0;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (omp_get_level() != b.level) return 0;
+    // A nested team would be serialized by the OpenMP runtime.
+    if (omp_in_parallel()
+            && omp_get_active_level() >= omp_get_max_active_levels())
+        return 0;
+#endif
+    return b.max_threads;
+}
+
+} // namespace impl
+} // namespace dnnl
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -63,10 +140,13 @@ inline int dnnl_in_parallel() {
 inline void dnnl_thr_barrier() {}
 
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-#include "omp.h"
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
-    return omp_get_max_threads();
+    const int budget = dnnl::impl::get_thread_budget();
+    if (budget == 0) return omp_get_max_threads();
+    // Inside an application parallel region the budget defines the size of
+    // the nested team regardless of the nthreads-var of that level.
+    return omp_in_parallel() ? budget : std::min(budget, omp_get_max_threads());
 }
 inline int dnnl_in_parallel() {
     return omp_in_parallel();
@@ -81,7 +161,9 @@ inline void dnnl_thr_barrier() {
 
 #define DNNL_THR_SYNC 0
 inline int dnnl_get_max_threads() {
-    return tbb::this_task_arena::max_concurrency();
+    const int nthr = tbb::this_task_arena::max_concurrency();
+    const int budget = dnnl::impl::get_thread_budget();
+    return budget > 0 ? std::min(budget, nthr) : nthr;
 }
 inline int dnnl_in_parallel() {
     return 0;
@@ -135,7 +217,9 @@ inline int dnnl_get_max_threads() {
 
     // Use the default max_concurrency only when no tp is passed by
     // user (e.g. primitive creation).
-    return tp ? std::max(1, tp->get_num_threads()) : max_concurrency;
+    const int nthr = tp ? std::max(1, tp->get_num_threads()) : max_concurrency;
+    const int budget = dnnl::impl::get_thread_budget();
+    return budget > 0 ? std::min(budget, nthr) : nthr;
 }
 inline int dnnl_in_parallel() {
     using namespace dnnl::impl::threadpool_utils;
@@ -147,6 +231,13 @@ inline void dnnl_thr_barrier() {
 }
 #endif
 
+/* Returns true if parallel sections started by the calling thread run
+ * sequentially: the thread is inside a parallel region and has no thread budget
+ * to open a nested team with. */
+inline bool dnnl_in_parallel_without_budget() {
+    return dnnl_in_parallel() && dnnl::impl::get_thread_budget() == 0;
+}
+
 /* The purpose of this function is to provide the number of threads the library
  * is aware of when this function is invoked. Since oneDNN does not allow nested
  * parallelism, inside a parallel region the number of available threads is 1.
@@ -161,11 +252,10 @@ inline void dnnl_thr_barrier() {
  *   invoked, return 1 since the main thread will do the work.
  */
 inline int dnnl_get_current_num_threads() {
-    if (dnnl_in_parallel()) return 1;
-#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    return omp_get_max_threads();
-#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
-    return tbb::this_task_arena::max_concurrency();
+    if (dnnl_in_parallel_without_budget()) return 1;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    return dnnl_get_max_threads();
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
@@ -265,7 +355,7 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
 inline int adjust_num_threads(int nthr, dim_t work_amount) {
     if (nthr == 0) nthr = dnnl_get_current_num_threads();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    return (work_amount == 1 || omp_in_parallel()) ? 1 : nthr;
+    return (work_amount == 1 || dnnl_in_parallel_without_budget()) ? 1 : nthr;
 #else
     return (int)std::min((dim_t)nthr, work_amount);
 #endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2025 Intel Corporation
+* Copyright 2021-2026 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdint>
+#include <functional>
+#include <new>
 #include <sstream>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -25,6 +28,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -32,6 +36,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/profiler.hpp"
 #include "common/stack_checker.hpp"
+#include "common/utils.hpp"
 #include "common/verbose.hpp"
 
 using namespace dnnl::impl;
@@ -46,17 +51,91 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
-std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
-    std::string s_ = std::to_string(M);
+std::string get_descriptor(dim_t M, dim_t N, dim_t K, dim_t batch = 1) {
+    const std::string b_ = batch != 1 ? std::to_string(batch) + "x" : "";
+    std::string s_ = b_ + std::to_string(M);
     s_ += "x";
     s_ += std::to_string(K);
     s_ += ":";
-    s_ += std::to_string(K);
+    s_ += b_ + std::to_string(K);
     s_ += "x";
     s_ += std::to_string(N);
     return s_;
 }
 
+// Public packed buffers are row-major, while the internal GEMM is column-major,
+// hence matrix A of the user is matrix B for the GEMM and vice versa.
+char swap_identifier(char identifier) {
+    if (identifier == 'A' || identifier == 'a') return 'B';
+    if (identifier == 'B' || identifier == 'b') return 'A';
+    return identifier;
+}
+
+// Header of a packed buffer. The packed layout depends on the library version
+// and on the CPU ISA, so those are recorded together with the problem to
+// reject a buffer that the GEMM would misinterpret.
+struct gemm_pack_header_t {
+    static constexpr uint32_t magic_value = 0x4b504e44; // "DNPK"
+    static constexpr uint32_t format_version = 1;
+    // The copy kernels store aligned vectors, so both the buffer and the
+    // packed data that follows the header are 64-byte aligned.
+    static constexpr size_t size = 64;
+
+    uint32_t magic;
+    uint32_t version;
+    int lib_version[3];
+    int isa;
+    // Data type of C, which tells the GEMM flavors apart.
+    data_type_t dt;
+    char identifier;
+    dim_t M, N, K;
+
+    gemm_pack_header_t(char identifier, data_type_t dt, dim_t M, dim_t N,
+            dim_t K)
+        : magic(magic_value)
+        , version(format_version)
+        , lib_version {dnnl_version()->major, dnnl_version()->minor,
+                  dnnl_version()->patch}
+        , isa(static_cast<int>(dnnl_get_effective_cpu_isa()))
+        , dt(dt)
+        , identifier(identifier == 'a' ? 'A' : identifier == 'b' ? 'B'
+                                                                  : identifier)
+        , M(M)
+        , N(N)
+        , K(K) {}
+
+    bool operator==(const gemm_pack_header_t &rhs) const {
+        return magic == rhs.magic && version == rhs.version
+                && lib_version[0] == rhs.lib_version[0]
+                && lib_version[1] == rhs.lib_version[1]
+                && lib_version[2] == rhs.lib_version[2] && isa == rhs.isa
+                && dt == rhs.dt && identifier == rhs.identifier && M == rhs.M
+                && N == rhs.N && K == rhs.K;
+    }
+};
+static_assert(sizeof(gemm_pack_header_t) <= gemm_pack_header_t::size,
+        "packed buffer header does not fit the reserved space");
+
+// Returns the packed data of a buffer, or nullptr when the buffer does not
+// match the problem.
+const void *get_packed_data(const void *packed, char identifier,
+        data_type_t dt, dim_t M, dim_t N, dim_t K) {
+    if (packed == nullptr) return nullptr;
+    const auto *header = static_cast<const gemm_pack_header_t *>(packed);
+    if (!(*header == gemm_pack_header_t(identifier, dt, M, N, K)))
+        return nullptr;
+    return static_cast<const char *>(packed) + gemm_pack_header_t::size;
+}
+
+bool is_pack_dst_ok(const void *dst) {
+    return dst != nullptr
+            && reinterpret_cast<uintptr_t>(dst) % gemm_pack_header_t::size == 0;
+}
+
+bool is_packed(char trans) {
+    return trans == 'P' || trans == 'p';
+}
+
 } // namespace
 #endif
 
@@ -67,7 +146,7 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
 #define MAYBE_RUN_STACK_CHECKER(_, func, ...) func(__VA_ARGS__)
 #endif
 
-#define MAYBE_VERBOSE(status, sdt_, wdt_, ddt_, ...) \
+#define MAYBE_VERBOSE_BATCH(status, batch_, sdt_, wdt_, ddt_, ...) \
     if (get_verbose(verbose_t::exec_profile, component_t::gemm_api)) { \
         double start_ms = get_msec(); \
         status = __VA_ARGS__; \
@@ -75,25 +154,31 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
         stringstream_t ss; \
         ss << "cpu,gemm_api,,undef,"; \
         const bool is_src_ab = (transa == 'N' || transa == 'n'); \
-        ss << "src_" << sdt_ << "::blocked:" << (is_src_ab ? "ab" : "ba") \
+        const bool is_batched = (batch_) != 1; \
+        const char *tag_ab = is_batched ? "abc" : "ab"; \
+        const char *tag_ba = is_batched ? "acb" : "ba"; \
+        ss << "src_" << sdt_ << "::blocked:" << (is_src_ab ? tag_ab : tag_ba) \
            << ":f0 "; \
         const bool is_wei_ab = (transb == 'N' || transb == 'n'); \
-        ss << "wei_" << wdt_ << "::blocked:" << (is_wei_ab ? "ab" : "ba") \
+        ss << "wei_" << wdt_ << "::blocked:" << (is_wei_ab ? tag_ab : tag_ba) \
            << ":f0 "; \
-        ss << "dst_" << ddt_ << "::blocked:ab:f0,"; \
+        ss << "dst_" << ddt_ << "::blocked:" << tag_ab << ":f0,"; \
         if (is_src_ab && lda != K) ss << "lda:" << lda << " "; \
         if (!is_src_ab && lda != M) ss << "lda:" << lda << " "; \
         if (is_wei_ab && ldb != N) ss << "ldb:" << ldb << " "; \
         if (!is_wei_ab && ldb != K) ss << "ldb:" << ldb << " "; \
         if (alpha != 1.f) ss << "attr-scales:src:common:" << alpha << " "; \
         if (beta != 0.f) ss << "attr-post-ops:sum:" << beta << " "; \
-        ss << ",," << get_descriptor(M, N, K); \
+        ss << ",," << get_descriptor(M, N, K, batch_); \
         VPROF(start_ms, primitive, exec, VERBOSE_profile, ss.str().c_str(), \
                 duration_ms); \
     } else { \
         status = __VA_ARGS__; \
     }
 
+#define MAYBE_VERBOSE(status, sdt_, wdt_, ddt_, ...) \
+    MAYBE_VERBOSE_BATCH(status, 1, sdt_, wdt_, ddt_, __VA_ARGS__)
+
 dnnl_status_t dnnl_sgemm(char transa, char transb, dim_t M, dim_t N, dim_t K,
         float alpha, const float *A, dim_t lda, const float *B, const dim_t ldb,
         float beta, float *C, dim_t ldc) {
@@ -141,6 +226,213 @@ dnnl_status_t dnnl_gemm_s8s8s32(char transa, char transb, char offsetc, dim_t M,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, dim_t lda,
+        const float *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch < 0 || (batch > 0 && utils::any_null(A, B, C)))
+        return dnnl_invalid_arguments;
+    const std::function<dnnl_status_t(dim_t)> gemm_one = [&](dim_t i) {
+        return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha, B[i],
+                &ldb, A[i], &lda, &beta, C[i], &ldc, nullptr, false);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "f32", "f32", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_batch, cpu::gemm_batch, batch,
+                    M, N, K, gemm_one));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_strided_batch(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch < 0 || stride_a < 0 || stride_b < 0 || stride_c < 0)
+        return dnnl_invalid_arguments;
+    const std::function<dnnl_status_t(dim_t)> gemm_one = [&](dim_t i) {
+        return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+                B + i * stride_b, &ldb, A + i * stride_a, &lda, &beta,
+                C + i * stride_c, &ldc, nullptr, false);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "f32", "f32", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_strided_batch, cpu::gemm_batch,
+                    batch, M, N, K, gemm_one));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *const *A,
+        dim_t lda, uint8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *co,
+        dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch < 0 || (batch > 0 && utils::any_null(A, B, C)))
+        return dnnl_invalid_arguments;
+    const std::function<dnnl_status_t(dim_t)> gemm_one = [&](dim_t i) {
+        return cpu::gemm_s8u8s32(&transb, &transa, c2f_offsetC(&offsetc), &N,
+                &M, &K, &alpha, B[i], &ldb, &bo, A[i], &lda, &ao, &beta, C[i],
+                &ldc, co);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "u8", "s8", "s32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_u8s8s32_batch, cpu::gemm_batch,
+                    batch, M, N, K, gemm_one));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_strided_batch(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch < 0 || stride_a < 0 || stride_b < 0 || stride_c < 0)
+        return dnnl_invalid_arguments;
+    const std::function<dnnl_status_t(dim_t)> gemm_one = [&](dim_t i) {
+        return cpu::gemm_s8u8s32(&transb, &transa, c2f_offsetC(&offsetc), &N,
+                &M, &K, &alpha, B + i * stride_b, &ldb, &bo, A + i * stride_a,
+                &lda, &ao, &beta, C + i * stride_c, &ldc, co);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "u8", "s8", "s32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_u8s8s32_strided_batch,
+                    cpu::gemm_batch, batch, M, N, K, gemm_one));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    const char identifier_f = swap_identifier(identifier);
+    size_t packed_size = 0;
+    CHECK(cpu::sgemm_pack_get_size(&identifier_f, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, &packed_size));
+    *size = gemm_pack_header_t::size + packed_size;
+    return dnnl_success;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (!is_pack_dst_ok(dst)) return dnnl_invalid_arguments;
+    const char identifier_f = swap_identifier(identifier);
+    float *packed = reinterpret_cast<float *>(
+            static_cast<char *>(dst) + gemm_pack_header_t::size);
+    CHECK(cpu::sgemm_pack(&identifier_f, &transb, &transa, &N, &M, &K, &ldb,
+            &lda, src, packed));
+    new (dst) gemm_pack_header_t(identifier, data_type::f32, M, N, K);
+    return dnnl_success;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb, float beta,
+        float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (is_packed(transa)) {
+        A = get_packed_data(A, 'A', data_type::f32, M, N, K);
+        if (A == nullptr) return dnnl_invalid_arguments;
+    }
+    if (is_packed(transb)) {
+        B = get_packed_data(B, 'B', data_type::f32, M, N, K);
+        if (B == nullptr) return dnnl_invalid_arguments;
+    }
+    const float alpha = 1.f;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_compute, cpu::sgemm_compute,
+                    &transb, &transa, &N, &M, &K,
+                    static_cast<const float *>(B), &ldb,
+                    static_cast<const float *>(A), &lda, &beta, C, &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    const char identifier_f = swap_identifier(identifier);
+    size_t packed_size = 0;
+    CHECK(cpu::gemm_s8u8s32_pack_get_size(&identifier_f, &transb, &transa, &N,
+            &M, &K, &ldb, &lda, &packed_size));
+    *size = gemm_pack_header_t::size + packed_size;
+    return dnnl_success;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (!is_pack_dst_ok(dst)) return dnnl_invalid_arguments;
+    const char identifier_f = swap_identifier(identifier);
+    void *packed = static_cast<char *>(dst) + gemm_pack_header_t::size;
+    CHECK(cpu::gemm_s8u8s32_pack(&identifier_f, &transb, &transa, &N, &M, &K,
+            &ldb, &lda, src, packed));
+    new (dst) gemm_pack_header_t(identifier, data_type::s32, M, N, K);
+    return dnnl_success;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (is_packed(transa)) {
+        A = get_packed_data(A, 'A', data_type::s32, M, N, K);
+        if (A == nullptr) return dnnl_invalid_arguments;
+    }
+    if (is_packed(transb)) {
+        B = get_packed_data(B, 'B', data_type::s32, M, N, K);
+        if (B == nullptr) return dnnl_invalid_arguments;
+    }
+    const float alpha = 1.f;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_u8s8s32_compute,
+                    cpu::gemm_s8u8s32_compute, &transb, &transa,
+                    c2f_offsetC(&offsetc), &N, &M, &K,
+                    static_cast<const int8_t *>(B), &ldb,
+                    static_cast<const uint8_t *>(A), &lda, &beta, C, &ldc,
+                    co));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
         char transb, dim_t M, dim_t N, dim_t K, float alpha,
         const bfloat16_t *A, dim_t lda, const bfloat16_t *B, dim_t ldb,
@@ -221,5 +513,6 @@ extern "C" dnnl_status_t DNNL_API dnnl_threadpool_interop_gemm_bf16bf16f32(
 }
 
 #undef MAYBE_VERBOSE
+#undef MAYBE_VERBOSE_BATCH
 
 #endif
@@ -209,15 +209,22 @@ struct matmul_pd_t : public primitive_desc_t {
                                         && wei_n_group_ok);
 
                 // Mask over K dim is allowed for decompression feature only.
+                const auto wei_dt = weights_md(0)->data_type;
                 const bool is_decompression_or_dynquant
-                        = utils::one_of(weights_md(0)->data_type, data_type::s8,
-                                  data_type::u8, data_type::s4, data_type::u4)
+                        = utils::one_of(wei_dt, data_type::s8, data_type::u8,
+                                  data_type::s4, data_type::u4)
                         && IMPLICATION(
                                 !types::is_integral_dt(src_md()->data_type),
                                 attr()->fpmath_.apply_to_int_);
+                // fp4 weights come with block scales, e.g. MXFP4 ones.
+                const bool is_fp4_decompression
+                        = utils::one_of(wei_dt, data_type::f4_e2m1,
+                                  data_type::f4_e3m0)
+                        && src_md()->data_type != wei_dt;
                 ok = ok
                         && IMPLICATION((mask & wei_qmask_K()),
-                                is_decompression_or_dynquant);
+                                is_decompression_or_dynquant
+                                        || is_fp4_decompression);
             } else if (arg == DNNL_ARG_SRC) {
                 ok = ok
                         && utils::one_of(mask, 0, src_qmask_K(),
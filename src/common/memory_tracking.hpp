@@ -248,8 +248,10 @@ enum {
     key_gemm_pretransposed_rhs,
     key_gemm_transposed_1xwrhs,
     key_generic_acc,
+    key_gnorm_coeffs,
     key_gnorm_cvt,
     key_gnorm_reduction,
+    key_gnorm_tmp_diff_ss,
     key_gnorm_tmp_mean,
     key_gnorm_tmp_var,
     key_iprod_bias_bf16_convert_wsp,
@@ -321,6 +323,7 @@ enum {
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_heap,
     key_wino_U,
     key_wino_V,
     key_wino_M,
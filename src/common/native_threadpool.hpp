@@ -0,0 +1,260 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_NATIVE_THREADPOOL_HPP
+#define COMMON_NATIVE_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) \
+        || defined(_M_IX86)
+#include <immintrin.h>
+#define DNNL_NATIVE_THREADPOOL_PAUSE() _mm_pause()
+#else
+#define DNNL_NATIVE_THREADPOOL_PAUSE() std::this_thread::yield()
+#endif
+
+#include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A fork-join threadpool with per-participant work stealing. It backs the
+// DNNL_CPU_RUNTIME=NATIVE build, where it is used as the default threadpool
+// whenever the user did not pass one to a stream.
+//
+// A parallel_for(n, fn) call splits [0, n) into nthr contiguous ranges, one
+// per participant (the calling thread is participant 0). A participant
+// executes its own range first and then steals the remaining iterations of
+// the other ranges, so unbalanced tasks and late workers do not stall the
+// whole section. Idle workers spin for a while before going to sleep.
+//
+// The pool is synchronous: parallel_for() returns once all the iterations
+// are done. Nested or concurrent submissions are executed sequentially by
+// the submitting thread.
+class native_threadpool_t : public dnnl::threadpool_interop::threadpool_iface {
+public:
+    explicit native_threadpool_t(
+            int nthr, bool pin_threads = false, int spin_count = 1 << 16)
+        : nthr_(nthr > 0 ? nthr : 1)
+        , spin_count_(spin_count)
+        , ranges_(new range_t[nthr_]) {
+        std::vector<int> cpus;
+        if (pin_threads) cpus = get_affinity_cpus();
+        workers_.reserve(nthr_ - 1);
+        for (int ithr = 1; ithr < nthr_; ithr++) {
+            int cpu = cpus.empty() ? -1 : cpus[ithr % cpus.size()];
+            workers_.emplace_back([this, ithr, cpu]() {
+                if (cpu >= 0) pin_to_cpu(cpu);
+                worker_loop(ithr);
+            });
+        }
+    }
+
+    ~native_threadpool_t() override {
+        stop_.store(true);
+        {
+            std::lock_guard<std::mutex> l(sleep_mutex_);
+            sleep_cv_.notify_all();
+        }
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    native_threadpool_t(const native_threadpool_t &) = delete;
+    native_threadpool_t &operator=(const native_threadpool_t &) = delete;
+
+    int get_num_threads() const override { return nthr_; }
+    bool get_in_parallel() const override { return in_parallel(); }
+    uint64_t get_flags() const override { return 0; }
+
+    void parallel_for(int n, const std::function<void(int, int)> &fn) override {
+        if (n <= 0) return;
+
+        std::unique_lock<std::mutex> submit(submit_mutex_, std::try_to_lock);
+        if (n == 1 || nthr_ == 1 || in_parallel() || !submit.owns_lock()) {
+            in_parallel_guard_t g;
+            for (int i = 0; i < n; i++)
+                fn(i, n);
+            return;
+        }
+
+        fn_ = &fn;
+        n_ = n;
+        n_done_.store(0, std::memory_order_relaxed);
+        for (int ithr = 0; ithr < nthr_; ithr++) {
+            int start = (int)((int64_t)n * ithr / nthr_);
+            int end = (int)((int64_t)n * (ithr + 1) / nthr_);
+            ranges_[ithr].next.store(start, std::memory_order_relaxed);
+            ranges_[ithr].end = end;
+        }
+
+        // Publish the job: a new generation with no workers attached.
+        const uint64_t gen = (state_.load() >> gen_shift_) + 1;
+        state_.store(gen << gen_shift_);
+        if (n_sleeping_.load() > 0) {
+            std::lock_guard<std::mutex> l(sleep_mutex_);
+            sleep_cv_.notify_all();
+        }
+
+        execute(0);
+
+        // No iterations are left to claim, so close the job for workers that
+        // have not attached yet and wait for the attached ones to finish.
+        state_.fetch_or(closed_bit_);
+        while (n_done_.load(std::memory_order_acquire) != n
+                || (state_.load(std::memory_order_acquire) & refs_mask_) != 0)
+            DNNL_NATIVE_THREADPOOL_PAUSE();
+
+        fn_ = nullptr;
+    }
+
+private:
+    // Padded to a cache line to keep participants' counters apart.
+    struct range_t {
+        std::atomic<int> next {0};
+        int end = 0;
+        char pad[64 - sizeof(std::atomic<int>) - sizeof(int)];
+    };
+
+    struct in_parallel_guard_t {
+        in_parallel_guard_t() : saved_(in_parallel()) { in_parallel() = true; }
+        ~in_parallel_guard_t() { in_parallel() = saved_; }
+        bool saved_;
+    };
+
+    // state_ layout: generation in the upper 32 bits, closed flag in bit 31,
+    // and the number of workers attached to the current job in the rest.
+    static constexpr int gen_shift_ = 32;
+    static constexpr uint64_t closed_bit_ = uint64_t(1) << 31;
+    static constexpr uint64_t refs_mask_ = closed_bit_ - 1;
+
+    static bool &in_parallel() {
+        static thread_local bool in_parallel_ = false;
+        return in_parallel_;
+    }
+
+    static std::vector<int> get_affinity_cpus() {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) != 0) return cpus;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+#endif
+        return cpus;
+    }
+
+    static void pin_to_cpu(int cpu) {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    // Claims and runs iterations, own range first, then steals from others.
+    void execute(int ithr) {
+        in_parallel_guard_t g;
+        const auto &fn = *fn_;
+        const int n = n_;
+        int n_executed = 0;
+        for (int k = 0; k < nthr_; k++) {
+            range_t &r = ranges_[(ithr + k) % nthr_];
+            if (r.next.load(std::memory_order_relaxed) >= r.end) continue;
+            for (int i = r.next.fetch_add(1); i < r.end;
+                    i = r.next.fetch_add(1)) {
+                fn(i, n);
+                n_executed++;
+            }
+        }
+        if (n_executed) n_done_.fetch_add(n_executed, std::memory_order_release);
+    }
+
+    void worker_loop(int ithr) {
+        uint64_t seen_gen = 0;
+        for (;;) {
+            uint64_t s = state_.load();
+            for (int spin = 0;
+                    (s >> gen_shift_) == seen_gen && !stop_.load(); spin++) {
+                if (spin < spin_count_) {
+                    DNNL_NATIVE_THREADPOOL_PAUSE();
+                } else {
+                    std::unique_lock<std::mutex> l(sleep_mutex_);
+                    n_sleeping_.fetch_add(1);
+                    sleep_cv_.wait(l, [&]() {
+                        return (state_.load() >> gen_shift_) != seen_gen
+                                || stop_.load();
+                    });
+                    n_sleeping_.fetch_sub(1);
+                }
+                s = state_.load();
+            }
+            if (stop_.load()) return;
+            seen_gen = s >> gen_shift_;
+
+            // Attach to the job unless the master has already closed it.
+            bool attached = false;
+            while ((s >> gen_shift_) == seen_gen && !(s & closed_bit_)) {
+                if (state_.compare_exchange_weak(s, s + 1)) {
+                    attached = true;
+                    break;
+                }
+            }
+            if (!attached) continue;
+
+            execute(ithr);
+            state_.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    const int nthr_;
+    const int spin_count_;
+    std::unique_ptr<range_t[]> ranges_;
+    std::vector<std::thread> workers_;
+
+    const std::function<void(int, int)> *fn_ = nullptr;
+    int n_ = 0;
+    std::atomic<int> n_done_ {0};
+    std::atomic<uint64_t> state_ {0};
+    std::atomic<bool> stop_ {false};
+
+    std::mutex submit_mutex_;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    std::atomic<int> n_sleeping_ {0};
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -501,6 +501,25 @@ struct reduction_desc_t : public op_desc_t {
     float eps {};
 };
 
+// A descriptor of a top-k operation.
+struct topk_desc_t : public op_desc_t {
+    topk_desc_t() : op_desc_t(primitive_kind::topk) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(topk_desc_t);
+
+    // The kind of top-k algorithm. Possible values: #dnnl_topk_max and
+    // #dnnl_topk_min.
+    alg_kind_t alg_kind {};
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination memory descriptor. The size of `axis` dimension is `k`.
+    memory_desc_t dst_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // The axis along which the elements are selected.
+    int axis {};
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t : public op_desc_t {
     softmax_desc_t() : op_desc_t(primitive_kind::softmax) {}
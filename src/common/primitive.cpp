@@ -41,6 +41,19 @@ using namespace dnnl::impl::primitive_kind;
 namespace dnnl {
 namespace impl {
 
+status_t primitive_t::init(engine_t *engine, bool use_global_scratchpad,
+        const cache_blob_t &cache_blob) {
+    cache_blob_ = cache_blob;
+    const size_t footprint_start = get_primitive_creation_footprint();
+    CHECK(init(engine));
+    // Nested primitives created from scratch are accounted as well.
+    creation_footprint_ = get_primitive_creation_footprint() - footprint_start;
+    use_global_scratchpad_ = use_global_scratchpad;
+    // The `cache_blob_` is no longer needed after primitive creation.
+    cache_blob_ = cache_blob_t();
+    return status::success;
+}
+
 nested_scratchpad_t::nested_scratchpad_t(const exec_ctx_t &master_ctx, int key,
         const std::shared_ptr<primitive_t> &nested_p) {
     auto scratchpad = master_ctx.get_scratchpad_grantor();
@@ -49,14 +49,7 @@ struct primitive_t : public c_compatible {
     virtual status_t init(impl::engine_t *engine) { return status::success; }
 
     status_t init(engine_t *engine, bool use_global_scratchpad,
-            const cache_blob_t &cache_blob) {
-        cache_blob_ = cache_blob;
-        CHECK(init(engine));
-        use_global_scratchpad_ = use_global_scratchpad;
-        // The `cache_blob_` is no longer needed after primitive creation.
-        cache_blob_ = cache_blob_t();
-        return status::success;
-    }
+            const cache_blob_t &cache_blob);
 
     const std::shared_ptr<primitive_desc_t> &pd() const { return pd_; }
     primitive_kind_t kind() const { return pd_->kind(); }
@@ -73,6 +66,12 @@ struct primitive_t : public c_compatible {
         return status::runtime_error;
     }
 
+    // Returns the amount of memory in bytes held by the primitive while it
+    // resides in the primitive cache. By default, it is the size of the
+    // JIT-generated code accounted during the primitive creation.
+    // Implementations that keep other long-living buffers should add them.
+    virtual size_t get_footprint() const { return creation_footprint_; }
+
     virtual status_t create_resource(
             impl::engine_t *engine, resource_mapper_t &mapper) const {
         return status::success;
@@ -126,6 +125,7 @@ protected:
     bool use_global_scratchpad_ = false;
     cache_blob_t cache_blob_;
     cache_state_t creation_cached_state_ = cache_state_t::miss;
+    size_t creation_footprint_ = 0;
 
 private:
     primitive_t() = delete;
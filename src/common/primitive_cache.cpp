@@ -32,7 +32,10 @@ struct primitive_cache_t {
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity, int nshards, size_t capacity_in_bytes)
+        : cache_(capacity, nshards) {
+        cache_.set_capacity_in_bytes(capacity_in_bytes);
+    };
 
     ~primitive_cache_t() = default;
 
@@ -41,6 +44,14 @@ struct primitive_cache_t {
     }
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
+    status_t set_capacity_in_bytes(size_t capacity_in_bytes) {
+        return cache_.set_capacity_in_bytes(capacity_in_bytes);
+    }
+    size_t get_capacity_in_bytes() const {
+        return cache_.get_capacity_in_bytes();
+    }
+    size_t get_size_in_bytes() const { return cache_.get_size_in_bytes(); }
+    cache_stats_t get_stats() const { return cache_.get_stats(); }
 
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
@@ -58,6 +69,9 @@ private:
         key.op_desc_ = pd->op_desc();
         key.attr_ = pd->attr();
     }
+    static size_t get_footprint(const primitive_t &p) {
+        return p.get_footprint();
+    }
     // Used for testing.
     friend size_t DNNL_API set_primitive_cache_capacity_without_clearing(
             size_t capacity);
@@ -65,7 +79,8 @@ private:
         cache_.set_capacity_without_clearing(capacity);
     }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    utils::lru_cache_t<key_t, primitive_t, result_t, update_key, get_footprint>
+            cache_;
 };
 
 primitive_cache_t &global_primitive_cache() {
@@ -75,7 +90,13 @@ primitive_cache_t &global_primitive_cache() {
 #else
     static const int capacity = 0;
 #endif
-    static primitive_cache_t cache(capacity);
+    // Sharding reduces lock contention when primitives are created from
+    // many threads concurrently.
+    static const int nshards = getenv_int_user("PRIMITIVE_CACHE_SHARDS", 16);
+    // The capacity in bytes is set in megabytes through the environment.
+    static const size_t capacity_in_bytes = (size_t)std::max(
+            getenv_int_user("PRIMITIVE_CACHE_CAPACITY_MB", 0), 0) * 1024 * 1024;
+    static primitive_cache_t cache(capacity, nshards, capacity_in_bytes);
     return cache;
 }
 
@@ -104,6 +125,24 @@ bool is_primitive_in_cache(const primitive_iface_t *p_iface) {
     return is_pd_in_cache(p_iface->pd());
 }
 
+status_t get_primitive_cache_stats(cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *stats = global_primitive_cache().get_stats();
+#endif
+    return dnnl::impl::status::success;
+}
+
+status_t get_primitive_cache_size_in_bytes(size_t *size) {
+    if (size == nullptr) return dnnl::impl::status::invalid_arguments;
+    *size = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *size = global_primitive_cache().get_size_in_bytes();
+#endif
+    return dnnl::impl::status::success;
+}
+
 size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
     size_t old_capacity = global_primitive_cache().get_capacity();
     global_primitive_cache().set_capacity_without_clearing((int)capacity);
@@ -148,6 +187,19 @@ status_t set_primitive_cache_capacity(
     return status::success;
 }
 
+static size_t &primitive_creation_footprint() {
+    static thread_local size_t footprint = 0;
+    return footprint;
+}
+
+void add_primitive_creation_footprint(size_t size) {
+    primitive_creation_footprint() += size;
+}
+
+size_t get_primitive_creation_footprint() {
+    return primitive_creation_footprint();
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -165,3 +217,22 @@ dnnl::impl::status_t dnnl_get_primitive_cache_capacity(int *capacity) {
 dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_capacity_in_bytes(
+        size_t *capacity) {
+    if (capacity == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *capacity = dnnl::impl::global_primitive_cache().get_capacity_in_bytes();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_capacity_in_bytes(
+        size_t capacity) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::global_primitive_cache().set_capacity_in_bytes(
+            capacity);
+#endif
+    return dnnl::impl::status::success;
+}
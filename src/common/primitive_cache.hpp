@@ -18,6 +18,7 @@
 #define COMMON_PRIMITIVE_CACHE_HPP
 
 #include "c_types_map.hpp"
+#include "cache_hit_types.hpp"
 #include "oneapi/dnnl/dnnl.h"
 #include "primitive_hashing.hpp"
 #include "type_helpers.hpp"
@@ -62,11 +63,19 @@ primitive_cache_iface_t primitive_cache();
 status_t set_primitive_cache_capacity(
         int primitive_capacity, int kernel_capacity);
 
+// Accounts `size` bytes of memory, e.g. JIT-generated code, allocated while
+// creating a primitive in the calling thread. The value is used to compute the
+// footprint of the primitive for the primitive cache capacity in bytes.
+void add_primitive_creation_footprint(size_t size);
+size_t get_primitive_creation_footprint();
+
 // Undocumented API for testing.
 status_t DNNL_API get_primitive_cache_size(int *size);
 bool DNNL_API is_primitive_in_cache(const primitive_iface_t *p_iface);
 bool DNNL_API is_pd_in_cache(const primitive_desc_iface_t *pd_iface);
 size_t DNNL_API set_primitive_cache_capacity_without_clearing(size_t capacity);
+status_t DNNL_API get_primitive_cache_stats(cache_stats_t *stats);
+status_t DNNL_API get_primitive_cache_size_in_bytes(size_t *size);
 
 } // namespace impl
 } // namespace dnnl
@@ -0,0 +1,471 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl_version.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "opdesc.hpp"
+#include "primitive.hpp"
+#include "primitive_attr.hpp"
+#include "primitive_cache_warmup.hpp"
+#include "primitive_desc_iterator.hpp"
+#include "serialization.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Bumped on any change of the record layout.
+constexpr int32_t manifest_format_version = 2;
+
+// Memory descriptors are serialized field by field: the raw structure has
+// padding bytes and unused union members, which would make identical records
+// differ.
+bool append_md(serialization_stream_t &sstream, const memory_desc_t &md) {
+    using namespace format_kind;
+    if (!utils::one_of(md.format_kind, undef, any, blocked)) return false;
+    if (md.extra.flags
+            & dnnl_memory_extra_flag_compensation_gpu_conv_asymmetric_src)
+        return false;
+
+    sstream.append(md.ndims);
+    for (int d = 0; d < md.ndims; d++) {
+        sstream.append(md.dims[d]);
+        sstream.append(md.padded_dims[d]);
+        sstream.append(md.padded_offsets[d]);
+    }
+    sstream.append(md.data_type);
+    sstream.append(md.offset0);
+    sstream.append(md.format_kind);
+    if (md.format_kind == blocked) {
+        const auto &blk = md.format_desc.blocking;
+        for (int d = 0; d < md.ndims; d++)
+            sstream.append(blk.strides[d]);
+        sstream.append(blk.inner_nblks);
+        for (int b = 0; b < blk.inner_nblks; b++) {
+            sstream.append(blk.inner_blks[b]);
+            sstream.append(blk.inner_idxs[b]);
+        }
+    }
+    sstream.append(md.extra.flags);
+    sstream.append(md.extra.compensation_mask);
+    sstream.append(md.extra.scale_adjust);
+    sstream.append(md.extra.asymm_compensation_mask);
+    return true;
+}
+
+bool pop_md(deserializer_t &d, memory_desc_t &md) {
+    md = memory_desc_t();
+    d.pop(md.ndims);
+    if (md.ndims < 0 || md.ndims > DNNL_MAX_NDIMS) return false;
+    for (int i = 0; i < md.ndims; i++) {
+        d.pop(md.dims[i]);
+        d.pop(md.padded_dims[i]);
+        d.pop(md.padded_offsets[i]);
+    }
+    d.pop(md.data_type);
+    d.pop(md.offset0);
+    d.pop(md.format_kind);
+    if (md.format_kind == format_kind::blocked) {
+        auto &blk = md.format_desc.blocking;
+        for (int i = 0; i < md.ndims; i++)
+            d.pop(blk.strides[i]);
+        d.pop(blk.inner_nblks);
+        if (blk.inner_nblks < 0 || blk.inner_nblks > DNNL_MAX_NDIMS)
+            return false;
+        for (int b = 0; b < blk.inner_nblks; b++) {
+            d.pop(blk.inner_blks[b]);
+            d.pop(blk.inner_idxs[b]);
+        }
+    } else if (!utils::one_of(
+                       md.format_kind, format_kind::undef, format_kind::any)) {
+        return false;
+    }
+    d.pop(md.extra.flags);
+    d.pop(md.extra.compensation_mask);
+    d.pop(md.extra.scale_adjust);
+    d.pop(md.extra.asymm_compensation_mask);
+    return true;
+}
+
+void append_dims(serialization_stream_t &sstream, const dims_t &dims) {
+    for (int i = 0; i < DNNL_MAX_NDIMS; i++)
+        sstream.append(dims[i]);
+}
+
+void pop_dims(deserializer_t &d, dims_t &dims) {
+    for (int i = 0; i < DNNL_MAX_NDIMS; i++)
+        d.pop(dims[i]);
+}
+
+bool append_op_desc(serialization_stream_t &sstream, const op_desc_t *op_desc) {
+    using namespace primitive_kind;
+    sstream.append(op_desc->primitive_kind);
+    switch ((int)op_desc->primitive_kind) {
+        case convolution:
+        case deconvolution: {
+            const auto *d = op_desc_t::to_desc<convolution_desc_t>(op_desc);
+            if (!utils::one_of(d->prop_kind, prop_kind::forward_training,
+                        prop_kind::forward_inference))
+                return false;
+            sstream.append(d->prop_kind);
+            sstream.append(d->alg_kind);
+            if (!(append_md(sstream, d->src_desc)
+                    && append_md(sstream, d->weights_desc)
+                    && append_md(sstream, d->bias_desc)
+                    && append_md(sstream, d->dst_desc)))
+                return false;
+            append_dims(sstream, d->strides);
+            append_dims(sstream, d->dilates);
+            append_dims(sstream, d->padding[0]);
+            append_dims(sstream, d->padding[1]);
+            sstream.append(d->accum_data_type);
+            sstream.append(d->use_inversion);
+            return true;
+        }
+        case inner_product: {
+            const auto *d = op_desc_t::to_desc<inner_product_desc_t>(op_desc);
+            if (!utils::one_of(d->prop_kind, prop_kind::forward_training,
+                        prop_kind::forward_inference))
+                return false;
+            sstream.append(d->prop_kind);
+            if (!(append_md(sstream, d->src_desc)
+                    && append_md(sstream, d->weights_desc)
+                    && append_md(sstream, d->bias_desc)
+                    && append_md(sstream, d->dst_desc)))
+                return false;
+            sstream.append(d->accum_data_type);
+            return true;
+        }
+        case matmul: {
+            const auto *d = op_desc_t::to_desc<matmul_desc_t>(op_desc);
+            if (!(append_md(sstream, d->src_desc)
+                    && append_md(sstream, d->weights_desc)
+                    && append_md(sstream, d->bias_desc)
+                    && append_md(sstream, d->dst_desc)
+                    && append_md(sstream, d->reduce_desc)))
+                return false;
+            sstream.append(d->reduce_kind);
+            sstream.append(d->accum_data_type);
+            return true;
+        }
+        default: return false;
+    }
+}
+
+std::unique_ptr<op_desc_t> pop_op_desc(deserializer_t &d) {
+    using namespace primitive_kind;
+    const auto kind = d.pop<primitive_kind_t>();
+    switch ((int)kind) {
+        case convolution:
+        case deconvolution: {
+            auto desc = utils::make_unique<convolution_desc_t>();
+            desc->primitive_kind = kind;
+            d.pop(desc->prop_kind);
+            d.pop(desc->alg_kind);
+            if (!pop_md(d, desc->src_desc)
+                    || !pop_md(d, desc->weights_desc)
+                    || !pop_md(d, desc->bias_desc)
+                    || !pop_md(d, desc->dst_desc))
+                return nullptr;
+            pop_dims(d, desc->strides);
+            pop_dims(d, desc->dilates);
+            pop_dims(d, desc->padding[0]);
+            pop_dims(d, desc->padding[1]);
+            d.pop(desc->accum_data_type);
+            d.pop(desc->use_inversion);
+            return std::move(desc);
+        }
+        case inner_product: {
+            auto desc = utils::make_unique<inner_product_desc_t>();
+            d.pop(desc->prop_kind);
+            if (!pop_md(d, desc->src_desc)
+                    || !pop_md(d, desc->weights_desc)
+                    || !pop_md(d, desc->bias_desc)
+                    || !pop_md(d, desc->dst_desc))
+                return nullptr;
+            d.pop(desc->accum_data_type);
+            return std::move(desc);
+        }
+        case matmul: {
+            auto desc = utils::make_unique<matmul_desc_t>();
+            if (!pop_md(d, desc->src_desc)
+                    || !pop_md(d, desc->weights_desc)
+                    || !pop_md(d, desc->bias_desc)
+                    || !pop_md(d, desc->dst_desc)
+                    || !pop_md(d, desc->reduce_desc))
+                return nullptr;
+            d.pop(desc->reduce_kind);
+            d.pop(desc->accum_data_type);
+            return std::move(desc);
+        }
+        default: return nullptr;
+    }
+}
+
+bool append_attr(
+        serialization_stream_t &sstream, const primitive_attr_t &attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto supported = smask_t::scales | smask_t::zero_points
+            | smask_t::post_ops | smask_t::sum_dt | smask_t::fpmath_mode
+            | smask_t::accumulation_mode;
+    if (!attr.has_default_values(supported) || attr.deterministic_)
+        return false;
+
+    sstream.append(attr.scratchpad_mode_);
+    sstream.append(attr.fpmath_.mode_);
+    sstream.append(attr.fpmath_.apply_to_int_);
+    sstream.append(attr.acc_mode_);
+    attr.scales_.serialize(sstream);
+    attr.zero_points_.serialize(sstream);
+
+    const auto &entries = attr.post_ops_.entry_;
+    sstream.append(entries.size());
+    for (const auto &e : entries) {
+        sstream.append(e.kind);
+        if (e.is_eltwise()) {
+            sstream.append(e.eltwise.alg);
+            sstream.append(e.eltwise.scale);
+            sstream.append(e.eltwise.alpha);
+            sstream.append(e.eltwise.beta);
+        } else if (e.is_sum(false, false)) {
+            sstream.append(e.sum.scale);
+            sstream.append(e.sum.zero_point);
+            sstream.append(e.sum.dt);
+        } else if (e.is_binary()) {
+            sstream.append(e.binary.alg);
+            if (!append_md(sstream, e.binary.user_src1_desc)
+                    || !append_md(sstream, e.binary.user_src2_desc))
+                return false;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+status_t pop_attr(deserializer_t &d, primitive_attr_t &attr) {
+    CHECK(attr.set_scratchpad_mode(d.pop<scratchpad_mode_t>()));
+    const auto fpmath_mode = d.pop<fpmath_mode_t>();
+    const auto apply_to_int = d.pop<bool>();
+    CHECK(attr.set_fpmath_mode(fpmath_mode, apply_to_int));
+    CHECK(attr.set_accumulation_mode(d.pop<accumulation_mode_t>()));
+    attr.scales_ = d.pop<scales_t>();
+    attr.zero_points_ = d.pop<zero_points_t>();
+
+    post_ops_t post_ops;
+    const auto n_entries = d.pop<size_t>();
+    if (n_entries > (size_t)post_ops_t::post_ops_limit)
+        return status::invalid_arguments;
+    for (size_t i = 0; i < n_entries; i++) {
+        const auto kind = d.pop<primitive_kind_t>();
+        switch ((int)kind) {
+            case primitive_kind::eltwise: {
+                const auto alg = d.pop<alg_kind_t>();
+                const auto scale = d.pop<float>();
+                const auto alpha = d.pop<float>();
+                const auto beta = d.pop<float>();
+                CHECK(post_ops.append_eltwise(scale, alg, alpha, beta));
+                break;
+            }
+            case primitive_kind::sum: {
+                const auto scale = d.pop<float>();
+                const auto zero_point = d.pop<int32_t>();
+                const auto dt = d.pop<data_type_t>();
+                CHECK(post_ops.append_sum(scale, zero_point, dt));
+                break;
+            }
+            case primitive_kind::binary: {
+                const auto alg = d.pop<alg_kind_t>();
+                memory_desc_t src1_md, src2_md;
+                if (!pop_md(d, src1_md) || !pop_md(d, src2_md))
+                    return status::invalid_arguments;
+                CHECK(post_ops.append_binary(alg, &src1_md,
+                        alg == alg_kind::binary_select ? &src2_md : nullptr));
+                break;
+            }
+            default: return status::invalid_arguments;
+        }
+    }
+    return attr.set_post_ops(post_ops);
+}
+
+std::string to_hex(const std::vector<uint8_t> &data) {
+    static const char digits[] = "0123456789abcdef";
+    std::string s;
+    s.reserve(2 * data.size());
+    for (auto c : data) {
+        s.push_back(digits[c >> 4]);
+        s.push_back(digits[c & 0xf]);
+    }
+    return s;
+}
+
+bool from_hex(const std::string &s, std::vector<uint8_t> &data) {
+    auto nibble = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    };
+    if (s.size() % 2) return false;
+    data.resize(s.size() / 2);
+    for (size_t i = 0; i < data.size(); i++) {
+        const int hi = nibble(s[2 * i]), lo = nibble(s[2 * i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        data[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+// Each line is `<hash> <payload>` where the hash protects the deserializer
+// from truncated or hand-edited records.
+std::string make_line(const serialization_stream_t &payload) {
+    serialization_stream_t hash(payload.get_hash());
+    return to_hex(hash.get_data()) + " " + to_hex(payload.get_data());
+}
+
+bool parse_line(const std::string &line, serialization_stream_t &payload) {
+    const auto pos = line.find(' ');
+    if (pos == std::string::npos) return false;
+
+    std::vector<uint8_t> hash_data, payload_data;
+    if (!from_hex(line.substr(0, pos), hash_data)
+            || hash_data.size() != sizeof(size_t))
+        return false;
+    if (!from_hex(line.substr(pos + 1), payload_data)) return false;
+
+    size_t hash = 0;
+    std::memcpy(&hash, hash_data.data(), sizeof(hash));
+    payload = serialization_stream_t::from_data(std::move(payload_data));
+    return payload.get_hash() == hash;
+}
+
+std::string get_record_path() {
+    // `getenv_string_user` lower-cases the value, which breaks file paths.
+    char path[1024] = {};
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        const std::string name = std::string(prefix) + "PRIMITIVE_CACHE_RECORD";
+        if (getenv(name.c_str(), path, sizeof(path)) > 0) return path;
+    }
+    return std::string();
+}
+
+const std::string &record_path() {
+    static const std::string path = get_record_path();
+    return path;
+}
+
+} // namespace
+
+bool is_primitive_cache_record_enabled() {
+    return !record_path().empty();
+}
+
+void primitive_cache_record(
+        const primitive_desc_t *pd, const engine_t *engine) {
+    if (!is_primitive_cache_record_enabled()) return;
+
+    serialization_stream_t payload;
+    payload.append(manifest_format_version);
+    payload.append(static_cast<int32_t>(DNNL_VERSION_MAJOR));
+    payload.append(static_cast<int32_t>(DNNL_VERSION_MINOR));
+    payload.append(static_cast<int32_t>(DNNL_VERSION_PATCH));
+    payload.append(engine->kind());
+    if (!append_op_desc(payload, pd->op_desc())) return;
+    if (!append_attr(payload, *pd->attr())) return;
+    const std::string impl_name = pd->name();
+    payload.append_array(impl_name.size(), impl_name.c_str());
+
+    const std::string line = make_line(payload);
+
+    static std::mutex mutex;
+    static std::unordered_set<std::string> recorded;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!recorded.insert(line).second) return;
+
+    std::ofstream ofs(record_path(), std::ios::app);
+    if (ofs) ofs << line << "\n";
+}
+
+status_t primitive_cache_warmup(
+        engine_t *engine, const char *path, int *n_created) {
+    if (!engine || !path) return status::invalid_arguments;
+    if (n_created) *n_created = 0;
+
+    std::ifstream ifs(path);
+    if (!ifs) return status::invalid_arguments;
+
+    // Corrupted records are skipped, the rest of the manifest is still used.
+    std::string line;
+    while (std::getline(ifs, line)) {
+        serialization_stream_t payload;
+        if (!parse_line(line, payload)) continue;
+
+        deserializer_t d(payload);
+        if (d.pop<int32_t>() != manifest_format_version) continue;
+        const bool version_match = d.pop<int32_t>() == DNNL_VERSION_MAJOR
+                && d.pop<int32_t>() == DNNL_VERSION_MINOR
+                && d.pop<int32_t>() == DNNL_VERSION_PATCH;
+        if (!version_match) continue;
+        if (d.pop<engine_kind_t>() != engine->kind()) continue;
+
+        auto op_desc = pop_op_desc(d);
+        if (!op_desc) continue;
+        primitive_attr_t attr;
+        if (pop_attr(d, attr) != status::success) continue;
+        std::string impl_name(d.pop<size_t>(), '\0');
+        for (auto &c : impl_name)
+            d.pop(c);
+
+        // Walk the implementations in the same order as the user did, so that
+        // the primitive descriptor ends up with the same cache key.
+        primitive_desc_iterator_t it(engine, op_desc.get(), &attr, nullptr);
+        if (!it.is_initialized()) return status::out_of_memory;
+        std::shared_ptr<primitive_desc_t> pd;
+        while (++it != it.end()) {
+            if (impl_name == (*it)->name()) {
+                pd = *it;
+                break;
+            }
+        }
+        // The implementation may be unavailable on this machine.
+        if (!pd) continue;
+
+        std::pair<std::shared_ptr<primitive_t>, cache_state_t> p;
+        CHECK(pd->create_primitive(p, engine, cache_blob_t(), false));
+        if (n_created) (*n_created)++;
+    }
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_primitive_cache_warmup(
+        dnnl_engine_t engine, const char *path, int *n_created) {
+    return dnnl::impl::primitive_cache_warmup(engine, path, n_created);
+}
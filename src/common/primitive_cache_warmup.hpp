@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_CACHE_WARMUP_HPP
+#define COMMON_PRIMITIVE_CACHE_WARMUP_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// The warmup manifest is a text file with one record per line. A record holds
+// everything needed to re-create a primitive descriptor: the engine kind, the
+// operation descriptor, the attributes and the name of the implementation.
+// Records are appended on top-level primitive cache misses when the
+// ONEDNN_PRIMITIVE_CACHE_RECORD environment variable points to a file.
+//
+// Only operations that dominate primitive creation time in inference are
+// supported: convolution, deconvolution, inner product (forward) and matmul.
+// Attributes are limited to scales, zero points, eltwise, sum and binary
+// post-ops and the fpmath, accumulation and scratchpad modes. Anything else is
+// silently not recorded.
+
+// Returns true if the primitive creation manifest should be recorded.
+bool is_primitive_cache_record_enabled();
+
+// Appends a record for `pd` to the manifest. Records are deduplicated by their
+// content, so a primitive that is evicted and created again is recorded once.
+void primitive_cache_record(const primitive_desc_t *pd, const engine_t *engine);
+
+// Creates every primitive listed in the manifest at `path` on `engine` so that
+// they are put into the primitive cache. Records for other engine kinds or
+// other library versions are skipped, as are corrupted ones. `n_created`
+// (optional) returns the number of primitives created.
+status_t primitive_cache_warmup(
+        engine_t *engine, const char *path, int *n_created = nullptr);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
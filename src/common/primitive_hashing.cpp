@@ -99,6 +99,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -719,6 +720,21 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis
+    seed = hash_combine(seed, desc.axis);
+    // Combined hash for topk desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -89,6 +89,7 @@ size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const topk_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
 template <typename T>
@@ -186,6 +187,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive_kind");
         }
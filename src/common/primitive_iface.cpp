@@ -14,9 +14,18 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -25,6 +34,7 @@
 
 #include "cache_hit_types.hpp"
 #include "primitive.hpp"
+#include "primitive_cache_warmup.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
@@ -84,6 +94,12 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
     }
+
+    if (p_iface.second == cache_state_t::miss
+            && is_primitive_cache_record_enabled())
+        primitive_cache_record(
+                p_iface.first->pd()->impl().get(), p_iface.first->engine());
+
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
 
@@ -257,6 +273,201 @@ status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     return success;
 }
 
+status_t dnnl_primitive_create_async(primitive_create_request_t **request,
+        const primitive_desc_iface_t *primitive_desc_iface) {
+    if (utils::any_null(request, primitive_desc_iface))
+        return invalid_arguments;
+    // Reorder primitive descriptors carry source and destination engines that
+    // a copy of the descriptor would lose.
+    if (primitive_desc_iface->impl()->kind() == primitive_kind::reorder)
+        return unimplemented;
+
+    auto r = utils::make_unique<primitive_create_request_t>(
+            primitive_desc_iface);
+    if (!r) return out_of_memory;
+    CHECK(r->init());
+    *request = r.release();
+    return success;
+}
+
+status_t dnnl_primitive_create_request_is_ready(
+        const primitive_create_request_t *request, int *is_ready) {
+    if (utils::any_null(request, is_ready)) return invalid_arguments;
+    *is_ready = request->is_ready();
+    return success;
+}
+
+status_t dnnl_primitive_create_request_get(
+        const primitive_create_request_t *request,
+        primitive_iface_t **primitive_iface) {
+    if (utils::any_null(request, primitive_iface)) return invalid_arguments;
+    return request->get(primitive_iface);
+}
+
+status_t dnnl_primitive_create_request_destroy(
+        primitive_create_request_t *request) {
+    delete request;
+    return success;
+}
+
+// primitive_create_request_t implementation
+namespace {
+// Threading context of the thread that requested an asynchronous creation.
+// The number of threads is a part of the primitive cache key, so the creation
+// thread must see the same value as the calling thread for the primitive to be
+// shared with synchronous creations made by the user.
+struct creation_threading_ctx_t {
+    creation_threading_ctx_t() : nthr_(dnnl_get_max_threads()) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        tp_ = threadpool_utils::get_active_threadpool();
+        max_concurrency_ = threadpool_utils::get_threadlocal_max_concurrency();
+#endif
+    }
+
+    // Applies the context to the calling worker thread for the lifetime of
+    // the returned object.
+    struct scope_t {
+        scope_t(const creation_threading_ctx_t &ctx) {
+            set_thread_budget(ctx.nthr_);
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+            omp_set_num_threads(ctx.nthr_);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+            threadpool_utils::get_threadlocal_max_concurrency()
+                    = ctx.max_concurrency_;
+            if (ctx.tp_) threadpool_utils::activate_threadpool(ctx.tp_);
+#endif
+        }
+        ~scope_t() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+            threadpool_utils::deactivate_threadpool();
+#endif
+            set_thread_budget(0);
+        }
+        DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+    };
+
+private:
+    int nthr_;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    dnnl::threadpool_interop::threadpool_iface *tp_;
+    int max_concurrency_;
+#endif
+};
+
+// A bounded pool of worker threads running asynchronous creations. Workers
+// are started on demand and are kept alive for the lifetime of the process.
+// The pool is intentionally never destroyed: joining threads from a static
+// destructor may deadlock at library unload.
+class creation_pool_t {
+public:
+    static creation_pool_t &get() {
+        static creation_pool_t *pool = new creation_pool_t();
+        return *pool;
+    }
+
+    void submit(std::function<void()> task) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        if (nidle_ < (int)tasks_.size() && nworkers_ < max_workers()) {
+            try {
+                std::thread([this] { work(); }).detach();
+                nworkers_++;
+            } catch (...) {
+                // Without any worker the task would never run.
+                if (nworkers_ == 0) {
+                    tasks_.pop_back();
+                    throw;
+                }
+            }
+        }
+        lock.unlock();
+        cv_.notify_one();
+    }
+
+private:
+    creation_pool_t() = default;
+
+    // Primitive creation is mostly single-threaded code generation. A few
+    // workers hide its latency without competing with the compute threads.
+    static int max_workers() {
+        static const int n = (int)std::max(
+                1u, std::min(4u, std::thread::hardware_concurrency()));
+        return n;
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            nidle_++;
+            cv_.wait(lock, [this] { return !tasks_.empty(); });
+            nidle_--;
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    int nworkers_ = 0;
+    int nidle_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(creation_pool_t);
+};
+} // namespace
+
+dnnl_primitive_create_request::dnnl_primitive_create_request(
+        const primitive_desc_iface_t *primitive_desc_iface)
+    : pd_(utils::make_unique<primitive_desc_iface_t>(
+            primitive_desc_iface->impl(), primitive_desc_iface->engine())) {}
+
+dnnl_primitive_create_request::~dnnl_primitive_create_request() {
+    if (!future_.valid()) return;
+    auto result = future_.get();
+    if (result.second) result.second->release();
+}
+
+status_t dnnl_primitive_create_request::init() {
+    if (!pd_) return out_of_memory;
+
+    const creation_threading_ctx_t ctx;
+    const primitive_desc_iface_t *pd = pd_.get();
+    try {
+        auto promise = std::make_shared<std::promise<result_t>>();
+        future_ = promise->get_future().share();
+        creation_pool_t::get().submit([ctx, pd, promise]() {
+            primitive_iface_t *p = nullptr;
+            status_t status = runtime_error;
+            {
+                creation_threading_ctx_t::scope_t scope(ctx);
+                status = primitive_create(&p, pd);
+            }
+            promise->set_value({status, status == success ? p : nullptr});
+        });
+    } catch (...) {
+        future_ = std::shared_future<result_t>();
+        return out_of_memory;
+    }
+    return success;
+}
+
+bool dnnl_primitive_create_request::is_ready() const {
+    return future_.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
+status_t dnnl_primitive_create_request::get(
+        primitive_iface_t **primitive_iface) const {
+    const auto &result = future_.get();
+    if (result.first != success) return result.first;
+    result.second->retain();
+    *primitive_iface = result.second;
+    return success;
+}
+
 // primitive_iface_t implementation
 dnnl_primitive::dnnl_primitive(
         const std::shared_ptr<primitive_t> &primitive, engine_t *engine)
@@ -293,6 +504,12 @@ status_t dnnl_primitive::init() {
         bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
                 ? false
                 : primitive_->use_global_scratchpad();
+        if (!scratchpad_debug::is_protect_scratchpad()
+                && use_scratchpad_pool(pd_->engine())) {
+            pooled_scratchpad_size_ = scratchpad_size;
+            return primitive_->create_resource(
+                    pd()->engine(), resource_mapper_);
+        }
         auto *scratchpad_ptr = create_scratchpad(
                 pd_->engine(), scratchpad_size, use_global_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
@@ -329,6 +546,14 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
         mem_storage = scratchpad_->get_memory_storage();
     }
 
+    std::unique_ptr<scratchpad_t> borrowed_scratchpad;
+    if (!mem_storage && pooled_scratchpad_size_ > 0) {
+        borrowed_scratchpad = ctx.stream()->scratchpad_pool()->borrow(
+                pooled_scratchpad_size_);
+        if (!borrowed_scratchpad) return out_of_memory;
+        mem_storage = borrowed_scratchpad->get_memory_storage();
+    }
+
     auto scratchpad_grantor
             = primitive_->pd()->scratchpad_registry().grantor(mem_storage, ctx);
     ctx.set_scratchpad_grantor(&scratchpad_grantor);
@@ -336,6 +561,10 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
 
     auto status = primitive_->execute(ctx);
     ctx.set_scratchpad_grantor(nullptr);
+
+    if (borrowed_scratchpad)
+        ctx.stream()->scratchpad_pool()->give_back(
+                std::move(borrowed_scratchpad));
     return status;
 }
 
@@ -18,6 +18,7 @@
 #define COMMON_PRIMITIVE_IFACE_HPP
 
 #include <assert.h>
+#include <future>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -79,6 +80,9 @@ private:
     std::atomic<int> counter_;
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    // Size of the scratchpad to borrow from the stream at execution, set when
+    // the primitive does not own a scratchpad.
+    size_t pooled_scratchpad_size_ = 0;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
 
@@ -86,6 +90,41 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
 };
 
+// dnnl_primitive_create_request is a user facing handle of a primitive that
+// is being created asynchronously.
+// The creation runs on a small pool of library worker threads with the
+// threading context of the requesting thread and goes through the regular
+// primitive cache path, so concurrent requests for the same primitive (either
+// asynchronous or not) are deduplicated by the primitive cache: only one of
+// them creates the primitive and the others wait for the shared result.
+//
+// The request holds its own copy of the primitive descriptor so the user is
+// free to destroy the original one right after the request is made.
+struct dnnl_primitive_create_request : public dnnl::impl::c_compatible {
+    dnnl_primitive_create_request(
+            const primitive_desc_iface_t *primitive_desc_iface);
+    ~dnnl_primitive_create_request();
+
+    // Starts the creation. Returns an error if the creation could not be
+    // scheduled.
+    dnnl::impl::status_t init();
+
+    bool is_ready() const;
+
+    // Waits for the creation to complete and returns a new reference to the
+    // created primitive.
+    dnnl::impl::status_t get(primitive_iface_t **primitive_iface) const;
+
+private:
+    using result_t = std::pair<dnnl::impl::status_t, primitive_iface_t *>;
+
+    std::unique_ptr<primitive_desc_iface_t> pd_;
+    std::shared_future<result_t> future_;
+
+    dnnl_primitive_create_request() = delete;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_create_request);
+};
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
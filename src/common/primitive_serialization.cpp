@@ -51,6 +51,7 @@ status_t serialize_desc(
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -571,6 +572,18 @@ void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.indices_desc);
+    // Axis
+    sstream.append(desc.axis);
+}
+
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -66,6 +66,15 @@ void rw_mutex_t::lock_write() {
 #endif
 }
 
+bool rw_mutex_t::try_lock_write() {
+    auto &impl = rw_mutex_impl_->impl();
+#ifdef _WIN32
+    return TryAcquireSRWLockExclusive(&impl) != 0;
+#else
+    return pthread_rwlock_trywrlock(&impl) == 0;
+#endif
+}
+
 void rw_mutex_t::unlock_read() {
     auto &impl = rw_mutex_impl_->impl();
 #ifdef _WIN32
@@ -100,6 +109,14 @@ lock_write_t::lock_write_t(rw_mutex_t &rw_mutex) : rw_mutex_(rw_mutex) {
     rw_mutex_.lock_write();
 }
 
+lock_write_t::lock_write_t(
+        rw_mutex_t &rw_mutex, std::atomic<size_t> &n_contended)
+    : rw_mutex_(rw_mutex) {
+    if (rw_mutex_.try_lock_write()) return;
+    n_contended.fetch_add(1, std::memory_order_relaxed);
+    rw_mutex_.lock_write();
+}
+
 lock_read_t::~lock_read_t() {
     rw_mutex_.unlock_read();
 }
@@ -17,6 +17,8 @@
 #ifndef COMMON_RW_MUTEX_HPP
 #define COMMON_RW_MUTEX_HPP
 
+#include <atomic>
+
 #include "utils.hpp"
 
 // As shared_mutex was introduced only in C++17
@@ -29,6 +31,8 @@ struct rw_mutex_t {
     rw_mutex_t();
     void lock_read();
     void lock_write();
+    // Returns false without blocking if the lock is held by another thread.
+    bool try_lock_write();
     void unlock_read();
     void unlock_write();
     ~rw_mutex_t();
@@ -50,6 +54,8 @@ private:
 
 struct lock_write_t {
     explicit lock_write_t(rw_mutex_t &rw_mutex_t);
+    // Increments `n_contended` if the lock could not be acquired immediately.
+    lock_write_t(rw_mutex_t &rw_mutex, std::atomic<size_t> &n_contended);
     ~lock_write_t();
     DNNL_DISALLOW_COPY_AND_ASSIGN(lock_write_t);
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2023 Intel Corporation
+* Copyright 2017-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,7 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
 
 #include "engine.hpp"
 #include "utils.hpp"
@@ -30,8 +40,198 @@ namespace impl {
 
 namespace {
 
-memory_storage_t *create_scratchpad_memory_storage(
-        engine_t *engine, size_t size) {
+// Returns the NUMA node of the CPU the calling thread runs on.
+int get_current_numa_node() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        return static_cast<int>(node);
+#endif
+    return 0;
+}
+
+// Returns the NUMA node of the page at `ptr` or -1 if it is unknown. The page
+// is expected to be touched already, so the node is the first-touch one.
+int get_page_numa_node(void *ptr) {
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+    constexpr unsigned long mpol_f_node = 1; // from <linux/mempolicy.h>
+    constexpr unsigned long mpol_f_addr = 2;
+    int node = -1;
+    if (syscall(SYS_get_mempolicy, &node, nullptr, 0, ptr,
+                mpol_f_node | mpol_f_addr)
+            == 0)
+        return node;
+#else
+    MAYBE_UNUSED(ptr);
+#endif
+    return -1;
+}
+
+// Interleaves the pages fully covered by [ptr, ptr + size) across the NUMA
+// nodes the process may allocate memory on. The pages are not touched, so they
+// get allocated on the first access.
+void interleave_numa_nodes(void *ptr, size_t size) {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+    constexpr int mpol_interleave = 3; // from <linux/mempolicy.h>
+    constexpr unsigned long mpol_f_mems_allowed = 4;
+    constexpr size_t mask_words = 16;
+    constexpr size_t max_nodes = mask_words * 8 * sizeof(unsigned long);
+
+    unsigned long nodes_mask[mask_words] = {};
+    if (syscall(SYS_get_mempolicy, nullptr, nodes_mask, max_nodes, nullptr,
+                mpol_f_mems_allowed)
+            != 0)
+        return;
+
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = utils::rnd_up(reinterpret_cast<size_t>(ptr), page_size);
+    const auto end = utils::rnd_dn(
+            reinterpret_cast<size_t>(ptr) + size, page_size);
+    if (begin >= end) return;
+
+    // Failure is not an error: the pages are then placed by the default
+    // first-touch policy.
+    syscall(SYS_mbind, begin, end - begin, mpol_interleave, nodes_mask,
+            max_nodes, 0);
+#else
+    MAYBE_UNUSED(ptr);
+    MAYBE_UNUSED(size);
+#endif
+}
+
+// A buffer that backs a CPU scratchpad. The structure must stay trivial as it
+// is a part of thread-local state of the global scratchpad.
+struct arena_block_t {
+    void *ptr;
+    size_t size;
+    int node;
+};
+
+// Scratchpad arena keeps the buffers of destroyed CPU scratchpads per NUMA
+// node and hands them out to the scratchpads created on the same node later.
+// A buffer is kept under the node its pages were first touched on, so the
+// pages first touched by the threads of one node are not reused by the threads
+// of another node, and the allocation cost is paid once for a sequence of
+// primitives with similar scratchpad sizes. Interleaved buffers are meant for
+// thread teams spanning several nodes and are shared by all of them.
+struct scratchpad_arena_t {
+    static scratchpad_arena_t &get() {
+        // Intentionally leaked: scratchpads may be released after the static
+        // objects are destroyed at exit.
+        static auto *arena = new scratchpad_arena_t();
+        return *arena;
+    }
+
+    arena_block_t acquire(size_t size) {
+        const int node = interleave_ ? any_node : get_current_numa_node();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto &pool = pools_[node];
+            // Do not waste blocks that are more than twice as large.
+            auto it = pool.lower_bound(size);
+            if (it != pool.end() && it->first <= 2 * size) {
+                arena_block_t block {it->second, it->first, node};
+                pool.erase(it);
+                cached_bytes_ -= block.size;
+                reused_bytes_ += block.size;
+                hits_++;
+                return block;
+            }
+            misses_++;
+        }
+
+        void *ptr = malloc(size, page_alignment);
+        if (!ptr) return {nullptr, 0, node};
+        if (interleave_) interleave_numa_nodes(ptr, size);
+
+        const size_t allocated = allocated_bytes_.fetch_add(size) + size;
+        size_t peak = peak_bytes_.load();
+        while (allocated > peak
+                && !peak_bytes_.compare_exchange_weak(peak, allocated)) {}
+        return {ptr, size, node};
+    }
+
+    void release(const arena_block_t &block) {
+        if (!block.ptr) return;
+        int node = block.node;
+        if (!interleave_) {
+            // The scratchpad may have been used by threads of a node other
+            // than the one of the creating thread.
+            const int page_node = get_page_numa_node(block.ptr);
+            if (page_node >= 0) node = page_node;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (cached_bytes_ + block.size <= capacity_) {
+                pools_[node].emplace(block.size, block.ptr);
+                cached_bytes_ += block.size;
+                return;
+            }
+        }
+        free(block.ptr);
+        allocated_bytes_ -= block.size;
+    }
+
+    void set_capacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        // Free the largest blocks first until the rest fits.
+        for (auto &pool : pools_) {
+            auto &blocks = pool.second;
+            while (cached_bytes_ > capacity_ && !blocks.empty()) {
+                auto it = std::prev(blocks.end());
+                cached_bytes_ -= it->first;
+                allocated_bytes_ -= it->first;
+                free(it->second);
+                blocks.erase(it);
+            }
+        }
+    }
+
+    void get_stats(scratchpad_arena_stats_t &stats) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.peak_bytes = peak_bytes_;
+        stats.reused_bytes = reused_bytes_;
+        stats.cached_bytes = cached_bytes_;
+        stats.hits = hits_;
+        stats.misses = misses_;
+    }
+
+private:
+    scratchpad_arena_t()
+        : capacity_(get_capacity_from_env())
+        , interleave_(getenv_int_user("SCRATCHPAD_NUMA_INTERLEAVE", 0) != 0) {}
+
+    static constexpr int page_alignment = 4096;
+    static constexpr int any_node = -1;
+
+    static size_t get_capacity_from_env() {
+        const int capacity_mb = getenv_int_user(
+                "SCRATCHPAD_ARENA_CAPACITY_MB", default_capacity_mb);
+        return (size_t)nstl::max(capacity_mb, 0) * 1024 * 1024;
+    }
+
+    // Enough to keep the scratchpads of a typical inference topology without
+    // a noticeable increase of the resident memory.
+    static constexpr int default_capacity_mb = 64;
+
+    size_t capacity_;
+    const bool interleave_;
+
+    std::mutex mutex_;
+    // Free blocks ordered by size, per NUMA node.
+    std::unordered_map<int, std::multimap<size_t, void *>> pools_;
+    size_t cached_bytes_ = 0;
+    size_t reused_bytes_ = 0;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+    std::atomic<size_t> allocated_bytes_ {0};
+    std::atomic<size_t> peak_bytes_ {0};
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_arena_t);
+};
+
+engine_t *get_scratchpad_engine(engine_t *engine) {
     // XXX: if engine is a non-native CPU engine (read: SYCL) then create
     // scratchpad through other, native CPU engine.
     //
@@ -42,22 +242,49 @@ memory_storage_t *create_scratchpad_memory_storage(
     // scratchpad has to be destroyed from inside a kernel. This doesn't
     // play well with SYCL runtime, so switching to native CPU engine for such
     // cases.
-    engine_t *mem_engine = nullptr;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-    mem_engine = (engine->kind() == engine_kind::cpu
-                         && !is_native_runtime(engine->runtime_kind()))
+    return (engine->kind() == engine_kind::cpu
+                   && !is_native_runtime(engine->runtime_kind()))
             ? cpu::get_service_engine()
             : engine;
 #else
-    mem_engine = engine;
+    return engine;
 #endif
+}
+
+// Creates a memory storage for a scratchpad. For CPU engines the storage
+// wraps a buffer from the scratchpad arena, which is returned in `block` and
+// must be released to the arena once the storage is destroyed.
+memory_storage_t *create_scratchpad_memory_storage(
+        engine_t *engine, size_t size, arena_block_t &block) {
+    engine_t *mem_engine = get_scratchpad_engine(engine);
+    block = {nullptr, 0, 0};
 
     memory_storage_t *mem_storage = nullptr;
+    if (mem_engine->kind() == engine_kind::cpu) {
+        block = scratchpad_arena_t::get().acquire(size);
+        if (!block.ptr) return nullptr;
+        auto status = mem_engine->create_memory_storage(&mem_storage,
+                memory_flags_t::use_runtime_ptr, size, block.ptr);
+        if (status != status::success) {
+            scratchpad_arena_t::get().release(block);
+            block = {nullptr, 0, 0};
+            return nullptr;
+        }
+        return mem_storage;
+    }
+
     auto status = mem_engine->create_memory_storage(&mem_storage, size);
     MAYBE_UNUSED(status);
     return mem_storage;
 }
 
+void destroy_scratchpad_memory_storage(
+        memory_storage_t *mem_storage, const arena_block_t &block) {
+    delete mem_storage;
+    scratchpad_arena_t::get().release(block);
+}
+
 } // namespace
 
 /*
@@ -66,20 +293,23 @@ memory_storage_t *create_scratchpad_memory_storage(
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
     concurrent_scratchpad_t(engine_t *engine, size_t size) : size_(size) {
-        auto *mem_storage = create_scratchpad_memory_storage(engine, size);
-        if (mem_storage == nullptr) size_ = 0;
+        mem_storage_ = create_scratchpad_memory_storage(engine, size, block_);
+        if (mem_storage_ == nullptr) size_ = 0;
+    }
 
-        mem_storage_.reset(mem_storage);
+    ~concurrent_scratchpad_t() override {
+        destroy_scratchpad_memory_storage(mem_storage_, block_);
     }
 
     const memory_storage_t *get_memory_storage() const override {
-        return mem_storage_.get();
+        return mem_storage_;
     }
 
     size_t size() const override { return size_; }
 
 private:
-    std::unique_ptr<memory_storage_t> mem_storage_;
+    memory_storage_t *mem_storage_;
+    arena_block_t block_;
     size_t size_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(concurrent_scratchpad_t);
@@ -94,12 +324,14 @@ struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         // TODO: check if engine is the same
         if (size > size_) {
-            delete mem_storage_;
+            destroy_scratchpad_memory_storage(mem_storage_, block_);
             // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
+            mem_storage_
+                    = create_scratchpad_memory_storage(engine, size, block_);
             if (mem_storage_ == nullptr) {
                 // Recreate scratchpad with original capacity
-                mem_storage_ = create_scratchpad_memory_storage(engine, size_);
+                mem_storage_ = create_scratchpad_memory_storage(
+                        engine, size_, block_);
                 if (mem_storage_ == nullptr) size_ = 0;
             } else
                 size_ = size;
@@ -110,8 +342,9 @@ struct global_scratchpad_t : public scratchpad_t {
     ~global_scratchpad_t() override {
         reference_count_--;
         if (reference_count_ == 0) {
-            delete mem_storage_;
+            destroy_scratchpad_memory_storage(mem_storage_, block_);
             mem_storage_ = nullptr;
+            block_ = {nullptr, 0, 0};
             size_ = 0;
         }
     }
@@ -125,6 +358,7 @@ struct global_scratchpad_t : public scratchpad_t {
 private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(global_scratchpad_t);
     thread_local static memory_storage_t *mem_storage_;
+    thread_local static arena_block_t block_;
     thread_local static size_t size_;
     thread_local static unsigned int reference_count_;
 };
@@ -135,6 +369,7 @@ private:
 // before all its users are destroyed thus causing a crash at exit.
 // Tested by tests/gtests/test_global_scratchad.cpp
 thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
+thread_local arena_block_t global_scratchpad_t::block_ = {nullptr, 0, 0};
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
@@ -159,5 +394,71 @@ scratchpad_t *create_scratchpad(
 #endif
 }
 
+bool use_scratchpad_pool(engine_t *engine) {
+#if defined(DNNL_ENABLE_CONCURRENT_EXEC) \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    // The scratchpad is given back once the execution call returns, which
+    // requires synchronous execution. Asynchronous threadpools and SYCL
+    // streams may still be running the primitive at that point.
+    return engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind());
+#else
+    UNUSED(engine);
+    return false;
+#endif
+}
+
+size_t scratchpad_pool_t::get_size_class(size_t size) {
+    constexpr size_t min_class = 4096;
+    if (size <= min_class) return min_class;
+
+    // Four classes per power of two: (pow2, 1.25 pow2, 1.5 pow2, 1.75 pow2].
+    size_t pow2 = min_class;
+    while (2 * pow2 < size)
+        pow2 *= 2;
+    return utils::rnd_up(size, pow2 / 4);
+}
+
+std::unique_ptr<scratchpad_t> scratchpad_pool_t::borrow(size_t size) {
+    const size_t size_class = get_size_class(size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Any larger scratchpad is fine: a stream that executes primitives
+        // one by one ends up with a single buffer of the largest size.
+        for (auto it = free_.lower_bound(size_class); it != free_.end();
+                ++it) {
+            if (it->second.empty()) continue;
+            auto scratchpad = std::move(it->second.back());
+            it->second.pop_back();
+            return scratchpad;
+        }
+    }
+
+    std::unique_ptr<scratchpad_t> scratchpad(
+            new concurrent_scratchpad_t(engine_, size_class));
+    if (!scratchpad->get_memory_storage()) return nullptr;
+    return scratchpad;
+}
+
+void scratchpad_pool_t::give_back(std::unique_ptr<scratchpad_t> scratchpad) {
+    if (!scratchpad) return;
+    const size_t size_class = scratchpad->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Larger scratchpads make the smaller ones redundant.
+    for (auto it = free_.begin(); it != free_.end() && it->first < size_class;)
+        it = free_.erase(it);
+    free_[size_class].push_back(std::move(scratchpad));
+}
+
+status_t get_scratchpad_arena_stats(scratchpad_arena_stats_t *stats) {
+    if (!stats) return status::invalid_arguments;
+    scratchpad_arena_t::get().get_stats(*stats);
+    return status::success;
+}
+
+void set_scratchpad_arena_capacity(size_t capacity) {
+    scratchpad_arena_t::get().set_capacity(capacity);
+}
+
 } // namespace impl
 } // namespace dnnl
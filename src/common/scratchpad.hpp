@@ -17,6 +17,11 @@
 #ifndef COMMON_SCRATCHPAD_HPP
 #define COMMON_SCRATCHPAD_HPP
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "c_types_map.hpp"
 #include "memory_storage.hpp"
 #include "utils.hpp"
@@ -30,9 +35,56 @@ struct scratchpad_t {
     virtual size_t size() const = 0;
 };
 
-scratchpad_t *create_scratchpad(
+scratchpad_t DNNL_API *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Returns true if primitives created on `engine` borrow a scratchpad from the
+// pool of the execution stream instead of owning one.
+bool DNNL_API use_scratchpad_pool(engine_t *engine);
+
+// A pool of scratchpads owned by a stream. A primitive that does not own a
+// scratchpad borrows one for the duration of an execution and gives it back
+// afterwards, so the memory scales with the number of concurrent executions
+// rather than with the number of primitives. Scratchpads are bucketed by size
+// classes, a class is at most 25% larger than the requested size.
+struct scratchpad_pool_t {
+    scratchpad_pool_t(engine_t *engine) : engine_(engine) {}
+
+    // Returns nullptr if the memory could not be allocated.
+    std::unique_ptr<scratchpad_t> borrow(size_t size);
+    void give_back(std::unique_ptr<scratchpad_t> scratchpad);
+
+    static size_t get_size_class(size_t size);
+
+private:
+    engine_t *engine_;
+    std::mutex mutex_;
+    std::map<size_t, std::vector<std::unique_ptr<scratchpad_t>>> free_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
+
+struct scratchpad_arena_stats_t {
+    // The largest total size of the CPU scratchpad buffers allocated at the
+    // same time, including the ones kept in the arena for reuse.
+    size_t peak_bytes = 0;
+    // The total size of the buffers taken from the arena instead of being
+    // allocated.
+    size_t reused_bytes = 0;
+    // The total size of the buffers kept in the arena at the moment.
+    size_t cached_bytes = 0;
+    // The number of buffers taken from the arena.
+    size_t hits = 0;
+    // The number of buffers allocated because the arena had no suitable one.
+    size_t misses = 0;
+};
+
+// Undocumented API for testing.
+status_t DNNL_API get_scratchpad_arena_stats(scratchpad_arena_stats_t *stats);
+// Sets the capacity of the arena in bytes and frees the kept buffers that do
+// not fit. Undocumented API for testing.
+void DNNL_API set_scratchpad_arena_capacity(size_t capacity);
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2024 Intel Corporation
+* Copyright 2016-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,9 +20,11 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
+#include "scratchpad.hpp"
 #include "stream.hpp"
 #include "utils.hpp"
 
@@ -32,6 +34,17 @@ using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::utils;
 
+dnnl_stream::dnnl_stream(engine_t *engine, stream_impl_t *impl)
+    : engine_(engine), impl_(impl) {}
+
+dnnl_stream::~dnnl_stream() = default;
+
+scratchpad_pool_t *dnnl_stream::scratchpad_pool() {
+    std::call_once(scratchpad_pool_once_,
+            [this] { scratchpad_pool_.reset(new scratchpad_pool_t(engine_)); });
+    return scratchpad_pool_.get();
+}
+
 status_t stream_t::enqueue_primitive(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     return primitive_iface->execute(ctx);
@@ -58,6 +71,33 @@ status_t dnnl_stream_get_engine(const stream_t *stream, engine_t **engine) {
     return success;
 }
 
+status_t dnnl_stream_set_max_threads(stream_t *stream, int max_threads) {
+    if (any_null(stream) || max_threads < 0) return invalid_arguments;
+    if (stream->engine()->kind() != engine_kind::cpu
+            || !is_native_runtime(stream->engine()->runtime_kind()))
+        return unimplemented;
+    stream->set_max_threads(max_threads);
+    return success;
+}
+
+status_t dnnl_stream_get_max_threads(const stream_t *stream, int *max_threads) {
+    if (any_null(stream, max_threads)) return invalid_arguments;
+    *max_threads = stream->max_threads();
+    return success;
+}
+
+status_t dnnl_set_thread_budget(int max_threads) {
+    if (max_threads < 0) return invalid_arguments;
+    set_thread_budget(max_threads);
+    return success;
+}
+
+status_t dnnl_get_thread_budget(int *max_threads) {
+    if (any_null(max_threads)) return invalid_arguments;
+    *max_threads = thread_budget().max_threads;
+    return success;
+}
+
 status_t dnnl_stream_wait(stream_t *stream) {
     bool args_ok = !any_null(stream);
     if (!args_ok) return invalid_arguments;
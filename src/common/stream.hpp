@@ -18,6 +18,7 @@
 #define COMMON_STREAM_HPP
 
 #include <assert.h>
+#include <mutex>
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
@@ -26,10 +27,16 @@
 #include "common/stream_impl.hpp"
 #include "common/utils.hpp"
 
+namespace dnnl {
+namespace impl {
+struct scratchpad_pool_t;
+} // namespace impl
+} // namespace dnnl
+
 struct dnnl_stream : public dnnl::impl::c_compatible {
-    dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl)
-        : engine_(engine), impl_(impl) {}
-    virtual ~dnnl_stream() = default;
+    dnnl_stream(
+            dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl);
+    virtual ~dnnl_stream();
 
     /** returns stream's engine */
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -73,11 +80,18 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     bool is_profiling_enabled() const { return impl_->is_profiling_enabled(); }
 
+    /** returns the thread budget of the stream, 0 means no budget */
+    int max_threads() const { return max_threads_; }
+    void set_max_threads(int max_threads) { max_threads_ = max_threads; }
+
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
     dnnl::impl::stream_impl_t *impl() { return impl_.get(); }
 
+    /** returns the pool of scratchpads borrowed by primitives at execution */
+    dnnl::impl::scratchpad_pool_t *scratchpad_pool();
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::impl::status_t get_threadpool(
             dnnl::threadpool_interop::threadpool_iface **threadpool) const {
@@ -91,6 +105,11 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+    int max_threads_ = 0;
+
+private:
+    std::once_flag scratchpad_pool_once_;
+    std::unique_ptr<dnnl::impl::scratchpad_pool_t> scratchpad_pool_;
 };
 
 #endif
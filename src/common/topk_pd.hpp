@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "tag_traits.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_TOPK_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, topk, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t topk_desc_init(topk_desc_t *topk_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int axis);
+
+// NOLINTBEGIN(google-default-arguments)
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+
+    using hint_class = topk_pd_t;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            case query::axis_s32: *(int *)result = desc()->axis; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return arg_usage_t::input;
+            case DNNL_ARG_DST:
+            case DNNL_ARG_DST_INDICES: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_INDICES: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        return &glob_zero_md;
+    }
+    // Index 1 stands for the indices of the selected elements.
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        if (index == 1)
+            return user_input ? &desc()->indices_desc : &indices_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    int axis() const { return desc_.axis; }
+    dim_t axis_size() const { return src_md_.dims[axis()]; }
+    dim_t k() const { return dst_md_.dims[axis()]; }
+    bool is_max() const { return desc_.alg_kind == alg_kind::topk_max; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md()).has_zero_dim();
+    }
+
+protected:
+    topk_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t indices_md_;
+
+    topk_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<topk_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc)
+        , indices_md_(desc_.indices_desc) {}
+
+    // Outputs with `any` format follow the order of src dimensions.
+    status_t set_default_params() {
+        const auto &src_blk = src_md_.format_desc.blocking;
+        for (auto *md : {&dst_md_, &indices_md_}) {
+            if (md->format_kind != format_kind::any) continue;
+            if (src_blk.inner_nblks == 0) {
+                CHECK(memory_desc_init_by_blocking_desc(*md, src_blk));
+            } else {
+                CHECK(memory_desc_init_by_tag(*md, get_abx_tag(md->ndims)));
+            }
+        }
+        return status::success;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -411,6 +411,9 @@ dnnl_cpu_isa_hints_t dnnl_get_cpu_isa_hints() {
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+#ifdef DNNL_CPU_NATIVE_THREADPOOL
+#include "common/native_threadpool.hpp"
+#endif
 namespace dnnl {
 namespace impl {
 namespace threadpool_utils {
@@ -418,12 +421,31 @@ namespace threadpool_utils {
 namespace {
 thread_local dnnl::threadpool_interop::threadpool_iface *active_threadpool
         = nullptr;
+
+#ifdef DNNL_CPU_NATIVE_THREADPOOL
+// The library-owned threadpool used when no threadpool was activated by a
+// stream. It is intentionally leaked to avoid joining worker threads during
+// static destruction.
+dnnl::threadpool_interop::threadpool_iface *get_native_threadpool() {
+    static auto *tp = new native_threadpool_t(
+            getenv_int_user("NATIVE_THREADPOOL_NUM_THREADS",
+                    (int)cpu::platform::get_max_threads_to_use()),
+            getenv_int_user("NATIVE_THREADPOOL_PIN", 0) != 0,
+            getenv_int_user("NATIVE_THREADPOOL_SPIN_COUNT", 1 << 16));
+    return tp;
 }
+#endif
+} // namespace
 
 void DNNL_API activate_threadpool(
         dnnl::threadpool_interop::threadpool_iface *tp) {
     // The assert here is put to prevent from activating a test threadpool while
     // the library one was left activating(not deactivated)
+#ifdef DNNL_CPU_NATIVE_THREADPOOL
+    // The native threadpool is the implicit default, it is never recorded as
+    // active so that streams can still activate a user threadpool.
+    if (tp == get_native_threadpool()) return;
+#endif
     assert(IMPLICATION(active_threadpool, active_threadpool == tp));
     if (!active_threadpool) active_threadpool = tp;
 }
@@ -433,6 +455,9 @@ void DNNL_API deactivate_threadpool() {
 }
 
 dnnl::threadpool_interop::threadpool_iface *get_active_threadpool() {
+#ifdef DNNL_CPU_NATIVE_THREADPOOL
+    if (!active_threadpool) return get_native_threadpool();
+#endif
     return active_threadpool;
 }
 
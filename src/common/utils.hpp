@@ -652,7 +652,7 @@ inline bool validate_dims(int ndims, const dims_t dims) {
 
 int32_t fetch_and_add(int32_t *dst, int32_t val);
 inline void yield_thread() {}
-bool is_destroying_cache_safe();
+bool DNNL_API is_destroying_cache_safe();
 
 // Reads an environment variable 'name' and stores its string value in the
 // 'buffer' of 'buffer_size' bytes (including the terminating zero) on
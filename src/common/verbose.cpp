@@ -57,6 +57,7 @@
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -231,6 +232,7 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 REGEX_SEARCH(k, softmax, regexp);
                 REGEX_SEARCH(k, layer_normalization, regexp);
                 REGEX_SEARCH(k, group_normalization, regexp);
+                REGEX_SEARCH(k, topk, regexp);
                 REGEX_SEARCH(k, graph, regexp);
                 REGEX_SEARCH(k, gemm_api, regexp);
                 REGEX_SEARCH(k, ukernel, regexp);
@@ -1330,6 +1332,31 @@ std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    auto indices_md = pd->dst_md(1);
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind())
+       << " ";
+    ss << md2fmt_str("indices", indices_md,
+            pd->invariant_dst_user_format_kind(DNNL_ARG_DST_INDICES));
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << " axis:" << pd->desc()->axis
+       << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
 std::string mds2str_reorder(const memory_desc_t *src_md,
         format_kind_t src_user_format_kind, const memory_desc_t *dst_md,
         format_kind_t dst_user_format_kind) {
@@ -1662,7 +1689,10 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1731,7 +1761,10 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1771,6 +1804,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(softmax);
             CASE(sum);
             CASE(sdpa);
+            CASE(topk);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
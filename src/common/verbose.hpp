@@ -231,9 +231,10 @@ struct component_t {
         softmax = 1 << 19,
         layer_normalization = 1 << 20,
         group_normalization = 1 << 21,
-        graph = 1 << 22,
-        gemm_api = 1 << 23,
-        ukernel = 1 << 24,
+        topk = 1 << 22,
+        graph = 1 << 23,
+        gemm_api = 1 << 24,
+        ukernel = 1 << 25,
         all = (uint32_t)-1,
     };
 };
@@ -216,8 +216,9 @@ struct jit_uni_dw_convolution_bwd_weights_t : public primitive_t {
                     && set_default_formats();
             if (!ok) return status::unimplemented;
 
-            const int max_threads
-                    = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+            const int max_threads = dnnl_in_parallel_without_budget()
+                    ? 1
+                    : dnnl_get_max_threads();
 
             status_t status = jit_uni_dw_conv_bwd_weights_kernel_t<isa,
                     src_type>::init_conf(jcp_, *desc(), *src_md(),
@@ -71,10 +71,20 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             nullptr,
         }},
         {{backward_data}, REG_BWD_PK({
+            CPU_INSTANCE_AMX(brgemm_deconvolution_bwd_data_t<avx10_2_512_amx_2>)
+            CPU_INSTANCE_AMX(brgemm_deconvolution_bwd_data_t<avx512_core_amx_fp16>)
+            CPU_INSTANCE_AMX(brgemm_deconvolution_bwd_data_t<avx512_core_amx>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_bwd_data_t<avx10_2_512>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_bwd_data_t<avx512_core_fp16>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_bwd_data_t<avx512_core_bf16>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_bwd_data_t<avx512_core>)
+            CPU_INSTANCE_AVX2(brgemm_deconvolution_bwd_data_t<avx2_vnni_2>)
+            CPU_INSTANCE_AVX2(brgemm_deconvolution_bwd_data_t<avx2>)
             CPU_INSTANCE(ref_deconvolution_bwd_data_t)
             nullptr,
         })},
         {{backward_weights}, REG_BWD_PK({
+            CPU_INSTANCE_AMX(brgemm_deconvolution_bwd_weights_t)
             CPU_INSTANCE(ref_deconvolution_bwd_weights_t)
             nullptr,
         })},
@@ -71,6 +71,7 @@ DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(topk);
 
 #undef DECLARE_IMPL_LIST
 
@@ -107,6 +108,7 @@ public:
             CASE(rnn);
             CASE(shuffle);
             CASE(softmax);
+            CASE(topk);
             case primitive_kind::sdpa: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
@@ -20,7 +20,6 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_group_normalization.hpp"
-#include "cpu/x64/jit_uni_instance_normalization.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
 
@@ -37,12 +36,12 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_GNORM_P({
         {{forward}, {
             CPU_INSTANCE_X64(jit_uni_group_normalization_fwd_t)
-            CPU_INSTANCE_X64(jit_uni_instance_normalization_fwd_t)
             CPU_INSTANCE(ncsp_group_normalization_fwd_t)
             CPU_INSTANCE(ref_group_normalization_fwd_t)
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
+            CPU_INSTANCE_X64(jit_uni_group_normalization_bwd_t)
             CPU_INSTANCE(ref_group_normalization_bwd_t)
             nullptr,
         })},
@@ -45,17 +45,23 @@ struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
         : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+#endif
 
     void before_exec_hook() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
         if (rc == status::success) threadpool_utils::activate_threadpool(tp);
+#endif
+        apply_stream_thread_budget(max_threads());
     }
 
     void after_exec_hook() override {
+        restore_thread_budget();
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         threadpool_utils::deactivate_threadpool();
-    }
 #endif
+    }
 };
 
 } // namespace cpu
@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/bfloat16.hpp"
@@ -311,6 +313,39 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+dnnl_status_t gemm_batch(dim_t batch, dim_t M, dim_t N, dim_t K,
+        const std::function<dnnl_status_t(dim_t)> &gemm_one) {
+    if (batch == 0) return dnnl_success;
+
+    const int nthr = dnnl_get_current_num_threads();
+    // Threading inside a small GEMM does not pay off, and a batch that is a
+    // near multiple of the number of threads keeps them all busy.
+    const bool is_small = M * N * K <= 64 * 64 * 64;
+    const bool is_balanced = utils::div_up(batch, nthr) * nthr * 4 <= batch * 5;
+    if (nthr == 1 || !(is_small || is_balanced)) {
+        for (dim_t i = 0; i < batch; i++) {
+            const dnnl_status_t st = gemm_one(i);
+            if (st != dnnl_success) return st;
+        }
+        return dnnl_success;
+    }
+
+    // A GEMM called from a parallel region runs on the calling thread only.
+    std::atomic<dnnl_status_t> status(dnnl_success);
+    parallel((int)nstl::min<dim_t>(nthr, batch), [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(batch, nthr, ithr, start, end);
+        for (dim_t i = start; i < end; i++) {
+            const dnnl_status_t st = gemm_one(i);
+            if (st != dnnl_success) {
+                status = st;
+                return;
+            }
+        }
+    });
+    return status;
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
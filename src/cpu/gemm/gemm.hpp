@@ -18,6 +18,8 @@
 #ifndef CPU_GEMM_GEMM_HPP
 #define CPU_GEMM_GEMM_HPP
 
+#include <functional>
+
 #include "oneapi/dnnl/dnnl_types.h"
 
 #include "common/bfloat16.hpp"
@@ -74,6 +76,12 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// Runs `gemm_one(i)` for every `i` in [0, batch). Small or evenly divisible
+// batches are split across threads with a single-threaded GEMM per problem,
+// otherwise the problems run one after another, each using all the threads.
+dnnl_status_t gemm_batch(dim_t batch, dim_t M, dim_t N, dim_t K,
+        const std::function<dnnl_status_t(dim_t)> &gemm_one);
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "x64:gemm:blas"
 #elif DNNL_X64
@@ -17,6 +17,7 @@
 
 #include <mutex>
 
+#include "common/primitive_cache.hpp"
 #include "common/utils.hpp"
 #include "common/verbose.hpp"
 
@@ -126,6 +127,8 @@ void register_jit_code_linux_perf(const void *code, size_t code_size,
 
 void register_jit_code(const void *code, size_t code_size,
         const char *code_name, const char *source_file_name) {
+    add_primitive_creation_footprint(code_size);
+
     // The #ifdef guards are required to avoid generating a function that only
     // consists of lock and unlock code
 #if DNNL_ENABLE_JIT_PROFILING || DNNL_ENABLE_JIT_DUMP
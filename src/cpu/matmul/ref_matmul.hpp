@@ -62,7 +62,7 @@ struct ref_matmul_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_MATMUL((src_type == wei_type
                                      || utils::one_of(wei_type, bf16, f16, u8,
-                                             s8, u4, s4, f4_e3m0)),
+                                             s8, u4, s4, f4_e2m1, f4_e3m0)),
                     VERBOSE_UNSUPPORTED_DT);
             /* int8 weights decompression support */
             VDISPATCH_MATMUL(IMPLICATION(utils::one_of(wei_type, u8, s8),
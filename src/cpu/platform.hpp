@@ -191,7 +191,7 @@ static constexpr bool is_ppc64() {
 #endif
 }
 
-size_t get_timestamp();
+size_t DNNL_API get_timestamp();
 
 } // namespace platform
 
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_topk.hpp"
+#include "cpu/topk_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_topk_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST_INDICES, status);
+    CHECK(status);
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper indices_d(pd()->dst_md(1));
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const topk_utils::cmp_t cmp(pd()->is_max());
+
+    // Every row is a line along the axis.
+    dims_t row_dims;
+    utils::array_copy(row_dims, dst_d.dims(), ndims);
+    row_dims[axis] = 1;
+    const dim_t nrows = utils::array_product(row_dims, ndims);
+
+    parallel_nd(nrows, [&](dim_t r) {
+        dims_t pos;
+        utils::l_dims_by_l_offset(pos, r, row_dims, ndims);
+
+        std::vector<topk_utils::entry_t> row(axis_size);
+        for (dim_t i = 0; i < axis_size; ++i) {
+            pos[axis] = i;
+            const float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off_v(pos));
+            row[i] = {s, i};
+        }
+        std::partial_sort(row.begin(), row.begin() + k, row.end(), cmp);
+
+        for (dim_t i = 0; i < k; ++i) {
+            pos[axis] = i;
+            io::store_float_value(
+                    dst_d.data_type(), row[i].value, dst, dst_d.off_v(pos));
+            indices[indices_d.off_v(pos)] = static_cast<int32_t>(row[i].idx);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
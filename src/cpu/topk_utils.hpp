@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_TOPK_UTILS_HPP
+#define CPU_TOPK_UTILS_HPP
+
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace topk_utils {
+
+struct entry_t {
+    float value;
+    dim_t idx;
+};
+
+// NaN is treated as greater than any number, so that the order is total.
+static inline bool greater(float a, float b) {
+    if (std::isnan(a)) return !std::isnan(b);
+    return a > b;
+}
+
+// Returns true if `a` precedes `b` in the output: by value first, then
+// by the lower index.
+struct cmp_t {
+    cmp_t(bool is_max) : is_max_(is_max) {}
+
+    bool operator()(const entry_t &a, const entry_t &b) const {
+        const float lhs = is_max_ ? a.value : b.value;
+        const float rhs = is_max_ ? b.value : a.value;
+        if (greater(lhs, rhs)) return true;
+        if (greater(rhs, lhs)) return false;
+        return a.idx < b.idx;
+    }
+
+private:
+    bool is_max_;
+};
+
+} // namespace topk_utils
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
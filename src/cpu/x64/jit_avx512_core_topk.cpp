@@ -0,0 +1,293 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_avx512_core_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+
+#define GET_OFF(field) offsetof(call_params_t, field)
+
+void jit_avx512_core_topk_kernel_t::load(const Zmm &zmm, const Address &addr) {
+    switch (dt_) {
+        case f32: vmovups(zmm, addr); break;
+        case bf16:
+            vpmovzxwd(zmm, addr);
+            vpslld(zmm, zmm, 16);
+            break;
+        case f16: vcvtph2ps(zmm, addr); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// NaN is ranked above any number, hence the unordered predicate: a NaN
+// threshold lets all elements through and a NaN element is always a
+// candidate. The exact check is done by the caller.
+void jit_avx512_core_topk_kernel_t::compare(const Opmask &k, const Zmm &zmm) {
+    if (is_max_)
+        vcmpps(k, zmm, zmm_thr_, _cmp_nle_us);
+    else
+        vcmpps(k, zmm_thr_, zmm, _cmp_nle_us);
+}
+
+void jit_avx512_core_topk_kernel_t::generate() {
+    Label l_unroll, l_vector, l_tail, l_found, l_end;
+
+    preamble();
+    mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
+    mov(reg_len_, ptr[reg_param_ + GET_OFF(len)]);
+    mov(reg_pos_, ptr[reg_param_ + GET_OFF(pos)]);
+    vbroadcastss(zmm_thr_, ptr[reg_param_ + GET_OFF(threshold)]);
+    xor_(reg_i_, reg_i_);
+
+    const auto src_addr = [&](int offt) {
+        return ptr[reg_src_ + reg_i_ * dt_size_ + offt * dt_size_];
+    };
+
+    // The unrolled loop only detects a block with a candidate, the vector
+    // loop below locates it.
+    L(l_unroll);
+    {
+        mov(reg_rem_, reg_len_);
+        sub(reg_rem_, reg_i_);
+        cmp(reg_rem_, unroll_ * simd_w_);
+        jl(l_vector, T_NEAR);
+        for (int u = 0; u < unroll_; u++) {
+            load(Zmm(u), src_addr(u * simd_w_));
+            compare(Opmask(u + 1), Zmm(u));
+        }
+        korw(k5, k1, k2);
+        korw(k6, k3, k4);
+        kortestw(k5, k6);
+        jnz(l_vector, T_NEAR);
+        add(reg_i_, unroll_ * simd_w_);
+        jmp(l_unroll, T_NEAR);
+    }
+
+    L(l_vector);
+    {
+        mov(reg_rem_, reg_len_);
+        sub(reg_rem_, reg_i_);
+        cmp(reg_rem_, simd_w_);
+        jl(l_tail, T_NEAR);
+        load(Zmm(0), src_addr(0));
+        compare(k1, Zmm(0));
+        kmovw(reg_mask_.cvt32(), k1);
+        test(reg_mask_.cvt32(), reg_mask_.cvt32());
+        jnz(l_found, T_NEAR);
+        add(reg_i_, simd_w_);
+        jmp(l_vector, T_NEAR);
+    }
+
+    L(l_tail);
+    {
+        mov(reg_mask_.cvt32(), 1);
+        shlx(reg_mask_.cvt32(), reg_mask_.cvt32(), reg_rem_.cvt32());
+        sub(reg_mask_.cvt32(), 1);
+        kmovw(k_tail_, reg_mask_.cvt32());
+        load(Zmm(0) | k_tail_ | T_z, src_addr(0));
+        compare(k1 | k_tail_, Zmm(0));
+        kmovw(reg_mask_.cvt32(), k1);
+        test(reg_mask_.cvt32(), reg_mask_.cvt32());
+        jnz(l_found, T_NEAR);
+        mov(reg_i_, reg_len_);
+        jmp(l_end, T_NEAR);
+    }
+
+    L(l_found);
+    tzcnt(reg_mask_.cvt32(), reg_mask_.cvt32());
+    add(reg_i_, reg_mask_);
+
+    L(l_end);
+    mov(ptr[reg_pos_], reg_i_);
+    postamble();
+}
+
+#undef GET_OFF
+
+status_t jit_avx512_core_topk_t::pd_t::init(engine_t *engine) {
+    const auto src_type = src_md(0)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    VDISPATCH_TOPK(mayiuse(avx512_core), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_TOPK(utils::one_of(src_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(dst_type == src_type, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_TOPK(set_default_params() == status::success,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    // Rows must be contiguous along the axis.
+    for (const auto *md : {src_md(0), dst_md(0), dst_md(1)}) {
+        const memory_desc_wrapper mdw(md);
+        VDISPATCH_TOPK(mdw.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_TOPK(mdw.dims()[axis()] == 1
+                        || mdw.blocking_desc().strides[axis()] == 1,
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    nthr_ = dnnl_get_max_threads();
+    nrows_ = axis_size() == 0
+            ? 0
+            : memory_desc_wrapper(src_md()).nelems() / axis_size();
+    nchunks_ = 1;
+    if (nrows_ > 0 && nrows_ < nthr_) {
+        // A chunk is long enough to amortize the merge of its k elements.
+        const dim_t min_chunk = nstl::max<dim_t>(4096, 4 * k());
+        nchunks_ = nstl::max<dim_t>(1,
+                nstl::min<dim_t>(
+                        utils::div_up(nthr_, nrows_), axis_size() / min_chunk));
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+void jit_avx512_core_topk_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    const dim_t nheaps = nchunks_ > 1 ? nrows_ * nchunks_ : nthr_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<topk_utils::entry_t>(key_topk_heap, nheaps * k());
+}
+
+status_t jit_avx512_core_topk_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_avx512_core_topk_kernel_t(
+                    pd()->src_md()->data_type, pd()->is_max())));
+    return kernel_->create_kernel();
+}
+
+void jit_avx512_core_topk_t::select(const char *src, dim_t start, dim_t end,
+        topk_utils::entry_t *heap) const {
+    const auto dt = pd()->src_md()->data_type;
+    const size_t dt_size = types::data_type_size(dt);
+    const dim_t k = pd()->k();
+    const topk_utils::cmp_t cmp(pd()->is_max());
+
+    for (dim_t i = 0; i < k; ++i)
+        heap[i] = {io::load_float_value(dt, src, start + i), start + i};
+    // The heap top is the lowest ranked selected element and serves as the
+    // threshold for the rest of the row.
+    std::make_heap(heap, heap + k, cmp);
+
+    for (dim_t i = start + k; i < end; ++i) {
+        i += (*kernel_)(src + i * dt_size, end - i, heap[0].value);
+        if (i == end) break;
+
+        const topk_utils::entry_t e {io::load_float_value(dt, src, i), i};
+        if (!cmp(e, heap[0])) continue;
+        std::pop_heap(heap, heap + k, cmp);
+        heap[k - 1] = e;
+        std::push_heap(heap, heap + k, cmp);
+    }
+    std::sort_heap(heap, heap + k, cmp);
+}
+
+status_t jit_avx512_core_topk_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST_INDICES, status);
+    CHECK(status);
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper indices_d(pd()->dst_md(1));
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const dim_t nrows = pd()->nrows_;
+    const dim_t nchunks = pd()->nchunks_;
+    const size_t src_dt_size = src_d.data_type_size();
+
+    dims_t row_dims;
+    utils::array_copy(row_dims, dst_d.dims(), ndims);
+    row_dims[axis] = 1;
+
+    auto heaps = ctx.get_scratchpad_grantor().template get<topk_utils::entry_t>(
+            memory_tracking::names::key_topk_heap);
+
+    const auto store_row = [&](dim_t r, const topk_utils::entry_t *best) {
+        dims_t pos;
+        utils::l_dims_by_l_offset(pos, r, row_dims, ndims);
+        const dim_t dst_off = dst_d.off_v(pos);
+        const dim_t indices_off = indices_d.off_v(pos);
+        for (dim_t i = 0; i < k; ++i) {
+            io::store_float_value(
+                    dst_d.data_type(), best[i].value, dst, dst_off + i);
+            indices[indices_off + i] = static_cast<int32_t>(best[i].idx);
+        }
+    };
+
+    parallel(pd()->nthr_, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nrows * nchunks, nthr, ithr, start, end);
+        for (dim_t w = start; w < end; ++w) {
+            const dim_t r = w / nchunks;
+            const dim_t c = w % nchunks;
+
+            dims_t pos;
+            utils::l_dims_by_l_offset(pos, r, row_dims, ndims);
+            const char *src_row = src + src_d.off_v(pos) * src_dt_size;
+
+            dim_t c_start = 0, c_end = 0;
+            balance211(axis_size, nchunks, c, c_start, c_end);
+
+            auto *heap = heaps + (nchunks > 1 ? w : ithr) * k;
+            select(src_row, c_start, c_end, heap);
+            if (nchunks == 1) store_row(r, heap);
+        }
+    });
+
+    if (nchunks == 1) return status::success;
+
+    // Chunks of a row are adjacent in the scratchpad, so the merge is a
+    // partial sort of their results.
+    const topk_utils::cmp_t cmp(pd()->is_max());
+    parallel_nd(nrows, [&](dim_t r) {
+        auto *best = heaps + r * nchunks * k;
+        std::partial_sort(best, best + k, best + nchunks * k, cmp);
+        store_row(r, best);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_TOPK_HPP
+#define CPU_X64_JIT_AVX512_CORE_TOPK_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/topk_utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Finds the first element of a row that ranks strictly higher than a given
+// threshold. Elements that do not pass the threshold are skipped at the
+// vector width, so the scalar heap update runs only for actual candidates.
+struct jit_avx512_core_topk_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_topk_kernel_t)
+
+    struct call_params_t {
+        const void *src;
+        dim_t len;
+        float threshold;
+        dim_t *pos;
+    };
+
+    jit_avx512_core_topk_kernel_t(data_type_t dt, bool is_max)
+        : jit_generator_t(jit_name(), avx512_core)
+        , dt_(dt)
+        , dt_size_(types::data_type_size(dt))
+        , is_max_(is_max) {}
+
+    // Returns the position of the first candidate or `len` if there is none.
+    dim_t operator()(const void *src, dim_t len, float threshold) const {
+        dim_t pos = len;
+        call_params_t p {src, len, threshold, &pos};
+        jit_generator_t::operator()(&p);
+        return pos;
+    }
+
+private:
+    static constexpr int simd_w_ = 16;
+    static constexpr int unroll_ = 4;
+
+    const data_type_t dt_;
+    const int dt_size_;
+    const bool is_max_;
+
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_src_ = r8;
+    const Xbyak::Reg64 reg_len_ = r9;
+    const Xbyak::Reg64 reg_i_ = r10;
+    const Xbyak::Reg64 reg_rem_ = r11;
+    const Xbyak::Reg64 reg_mask_ = rax;
+    const Xbyak::Reg64 reg_pos_ = rbx;
+
+    const Xbyak::Zmm zmm_thr_ = Xbyak::Zmm(31);
+    const Xbyak::Opmask k_tail_ = k7;
+
+    void load(const Xbyak::Zmm &zmm, const Xbyak::Address &addr);
+    void compare(const Xbyak::Opmask &k, const Xbyak::Zmm &zmm);
+    void generate() override;
+};
+
+struct jit_avx512_core_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", avx512_core, ""),
+                jit_avx512_core_topk_t);
+
+        status_t init(engine_t *engine);
+
+        int nthr_ = 0;
+        dim_t nrows_ = 0;
+        // Long rows are split into chunks processed by different threads
+        // when there are not enough rows to occupy all of them.
+        dim_t nchunks_ = 1;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_avx512_core_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Selects the top-k elements of [start, end) of a row into `heap`,
+    // sorted best-first.
+    void select(const char *src, dim_t start, dim_t end,
+            topk_utils::entry_t *heap) const;
+
+    std::unique_ptr<jit_avx512_core_topk_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -141,6 +141,56 @@ status_t bwd_conv_desc_create(const deconvolution_desc_t *fwd_deconv_d,
 
     return status::success;
 }
+status_t bwd_data_conv_desc_create(const deconvolution_desc_t *bwd_deconv_d,
+        convolution_desc_t *fwd_conv_d) {
+    const memory_desc_t *deconv_weights_d = &bwd_deconv_d->weights_desc;
+    const bool with_groups
+            = deconv_weights_d->ndims == bwd_deconv_d->diff_dst_desc.ndims + 1;
+
+    memory_desc_t conv_weights_d;
+    VDISPATCH_DECONVOLUTION_IC(weights_axes_permutation(&conv_weights_d,
+                                       deconv_weights_d, with_groups)
+                    == status::success,
+            VERBOSE_DESC_CREATION_FAIL, "weights");
+
+    const status_t desc_init_status = conv_desc_init(fwd_conv_d,
+            prop_kind::forward_training, alg_kind::convolution_direct,
+            &bwd_deconv_d->diff_dst_desc, &conv_weights_d, nullptr,
+            &bwd_deconv_d->diff_src_desc, bwd_deconv_d->strides,
+            bwd_deconv_d->dilates, bwd_deconv_d->padding[0],
+            bwd_deconv_d->padding[1]);
+    VDISPATCH_DECONVOLUTION_IC(desc_init_status == status::success,
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "fwd_conv");
+
+    return status::success;
+}
+
+status_t bwd_weights_conv_desc_create(
+        const deconvolution_desc_t *bwd_deconv_d,
+        convolution_desc_t *bwd_conv_d) {
+    const memory_desc_t *deconv_weights_d = &bwd_deconv_d->diff_weights_desc;
+    const bool with_groups
+            = deconv_weights_d->ndims == bwd_deconv_d->diff_dst_desc.ndims + 1;
+
+    memory_desc_t conv_weights_d;
+    VDISPATCH_DECONVOLUTION_IC(weights_axes_permutation(&conv_weights_d,
+                                       deconv_weights_d, with_groups)
+                    == status::success,
+            VERBOSE_DESC_CREATION_FAIL, "weights");
+
+    // The bias gradient is computed by the deconvolution, not by the
+    // convolution, as they reduce different tensors.
+    const status_t desc_init_status = conv_desc_init(bwd_conv_d,
+            prop_kind::backward_weights, alg_kind::convolution_direct,
+            &bwd_deconv_d->diff_dst_desc, &conv_weights_d, nullptr,
+            &bwd_deconv_d->src_desc, bwd_deconv_d->strides,
+            bwd_deconv_d->dilates, bwd_deconv_d->padding[0],
+            bwd_deconv_d->padding[1]);
+    VDISPATCH_DECONVOLUTION_IC(desc_init_status == status::success,
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "bwd_w_conv");
+
+    return status::success;
+}
 } // namespace
 
 template <typename implementation_pd>
@@ -298,6 +348,310 @@ status_t brgemm_deconvolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     return conv_p_->execute(conv_ctx);
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    const auto diff_src_type = desc()->diff_src_desc.data_type;
+    const auto wei_type = desc()->weights_desc.data_type;
+    const auto diff_dst_type = desc()->diff_dst_desc.data_type;
+
+    VDISPATCH_DECONVOLUTION(
+            desc()->prop_kind == prop_kind::backward_data, VERBOSE_BAD_PROPKIND);
+    VDISPATCH_DECONVOLUTION((desc()->alg_kind & alg_kind::deconvolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_DECONVOLUTION(
+            utils::one_of(wei_type, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_DECONVOLUTION(diff_dst_type == wei_type, VERBOSE_INCONSISTENT_DT,
+            "diff_dst", "weights");
+    VDISPATCH_DECONVOLUTION(utils::one_of(diff_src_type, wei_type, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_DECONVOLUTION(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_DECONVOLUTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_DECONVOLUTION(
+            impl::is_dense_format_kind(
+                    {diff_src_md(0), weights_md(0), diff_dst_md(0)}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    convolution_desc_t conv_d = convolution_desc_t();
+    CHECK(bwd_data_conv_desc_create(desc(), &conv_d));
+
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&conv_d), attr(), nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    while (++it != it.end()) {
+        conv_pd_ = *it;
+        if (conv_pd_->weights_md()->extra.flags != 0) continue;
+        if (check_embedded_impl_init<
+                    typename brgemm_1x1_convolution_fwd_t<isa>::pd_t>(it)
+                == status::success)
+            break;
+        if (check_embedded_impl_init<
+                    typename brgemm_convolution_fwd_t<isa>::pd_t>(it)
+                == status::success)
+            break;
+    }
+    if (it == it.end())
+        VDISPATCH_DECONVOLUTION_IC(
+                false, "brgemm implementation not found for convolution");
+
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(weights_axes_permutation(
+                &weights_md_, conv_pd_->weights_md(), with_groups()));
+    if (diff_src_md_.format_kind == format_kind::any)
+        diff_src_md_ = *conv_pd_->dst_md();
+    if (diff_dst_md_.format_kind == format_kind::any)
+        diff_dst_md_ = *conv_pd_->src_md();
+
+    init_name();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_nested,
+            conv_pd_->scratchpad_registry());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &args = ctx.args();
+    exec_args_t conv_args;
+    conv_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_DIFF_DST);
+    conv_args[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
+    conv_args[DNNL_ARG_DST] = args.at(DNNL_ARG_DIFF_SRC);
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, memory_tracking::names::key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+status_t brgemm_deconvolution_bwd_weights_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    const auto src_type = desc()->src_desc.data_type;
+    const auto diff_wei_type = desc()->diff_weights_desc.data_type;
+    const auto diff_dst_type = desc()->diff_dst_desc.data_type;
+
+    VDISPATCH_DECONVOLUTION(desc()->prop_kind == prop_kind::backward_weights,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_DECONVOLUTION((desc()->alg_kind & alg_kind::deconvolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_DECONVOLUTION(
+            utils::one_of(src_type, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_DECONVOLUTION(diff_dst_type == src_type, VERBOSE_INCONSISTENT_DT,
+            "diff_dst", "src");
+    VDISPATCH_DECONVOLUTION(utils::one_of(diff_wei_type, src_type, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    if (with_bias()) {
+        const auto diff_bia_type = desc()->diff_bias_desc.data_type;
+        VDISPATCH_DECONVOLUTION(utils::one_of(diff_bia_type, src_type, f32),
+                VERBOSE_UNSUPPORTED_BIAS_CFG);
+    }
+    VDISPATCH_DECONVOLUTION(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_DECONVOLUTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_DECONVOLUTION(
+            impl::is_dense_format_kind({src_md(0), diff_weights_md(0),
+                    diff_weights_md(1), diff_dst_md(0)}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    convolution_desc_t conv_d = convolution_desc_t();
+    CHECK(bwd_weights_conv_desc_create(desc(), &conv_d));
+
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&conv_d), attr(), nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    while (++it != it.end()) {
+        conv_pd_ = *it;
+        if (conv_pd_->diff_weights_md()->extra.flags != 0) continue;
+        if (check_embedded_impl_init<
+                    brgemm_convolution_bwd_weights_t::pd_t>(it)
+                == status::success)
+            break;
+    }
+    if (it == it.end())
+        VDISPATCH_DECONVOLUTION_IC(
+                false, "brgemm implementation not found for convolution");
+
+    if (diff_weights_md_.format_kind == format_kind::any)
+        CHECK(weights_axes_permutation(
+                &diff_weights_md_, conv_pd_->diff_weights_md(), with_groups()));
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->diff_dst_md();
+    if (diff_dst_md_.format_kind == format_kind::any)
+        diff_dst_md_ = *conv_pd_->src_md();
+    if (diff_bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_bias_md_, format_tag::x));
+
+    if (with_bias()) CHECK(init_bias_reduction());
+
+    init_name();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_nested,
+            conv_pd_->scratchpad_registry());
+    if (with_bias())
+        scratchpad.book<float>(memory_tracking::names::key_deconv_bias,
+                nthr_bias_ * bias_acc_stride());
+
+    return status::success;
+}
+
+status_t brgemm_deconvolution_bwd_weights_t::pd_t::init_bias_reduction() {
+    using namespace format_tag;
+    const memory_desc_wrapper diff_dst_d(diff_dst_md());
+    VDISPATCH_DECONVOLUTION_IC(diff_dst_d.is_dense(true),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+
+    const int nd = ndims();
+    if (diff_dst_d.matches_one_of_tag(utils::pick(nd - 3, nwc, nhwc, ndhwc))
+            != undef)
+        bias_blk_ = 1;
+    else if (diff_dst_d.matches_one_of_tag(
+                     utils::pick(nd - 3, nCw16c, nChw16c, nCdhw16c))
+            != undef)
+        bias_blk_ = 16;
+    else if (diff_dst_d.matches_one_of_tag(
+                     utils::pick(nd - 3, nCw8c, nChw8c, nCdhw8c))
+            != undef)
+        bias_blk_ = 8;
+    else
+        VDISPATCH_DECONVOLUTION_IC(
+                false, VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+
+    // Each thread reduces a contiguous range of (mb, spatial) points into its
+    // own accumulator, so keep a reasonable amount of work per thread.
+    const dim_t work_amount = MB() * OD() * OH() * OW();
+    constexpr dim_t min_work_per_thr = 64;
+    nthr_bias_ = (int)nstl::max((dim_t)1,
+            nstl::min((dim_t)dnnl_get_max_threads(),
+                    work_amount / min_work_per_thr));
+
+    return status::success;
+}
+
+status_t brgemm_deconvolution_bwd_weights_t::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <typename ddst_data_t, typename dbia_data_t>
+void brgemm_deconvolution_bwd_weights_t::compute_diff_bias(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const ddst_data_t *, DNNL_ARG_DIFF_DST);
+    auto diff_bias = CTX_OUT_MEM(dbia_data_t *, DNNL_ARG_DIFF_BIAS);
+    float *acc = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_deconv_bias);
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const auto &strides = diff_dst_d.blocking_desc().strides;
+    diff_dst += diff_dst_d.offset0();
+
+    const dim_t OC = pd()->OC();
+    const dim_t SP = pd()->OD() * pd()->OH() * pd()->OW();
+    const dim_t work_amount = pd()->MB() * SP;
+    const dim_t blk = pd()->bias_blk_;
+    const dim_t nb_oc = utils::div_up(OC, blk);
+    const dim_t acc_stride = pd()->bias_acc_stride();
+    const int nthr_bias = pd()->nthr_bias_;
+
+    // parallel() may run fewer threads than requested, while the reduction
+    // below sums up all the nthr_bias partial accumulators.
+    utils::array_set(acc, 0.f, nthr_bias * acc_stride);
+
+    parallel(nthr_bias, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+        float *thr_acc = acc + ithr * acc_stride;
+
+        if (blk == 1) {
+            // Channels-last: points are rows of OC contiguous channels.
+            for (dim_t iwork = start; iwork < end; iwork++) {
+                const ddst_data_t *row = diff_dst + iwork * OC;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < OC; c++)
+                    thr_acc[c] += static_cast<float>(row[c]);
+            }
+            return;
+        }
+
+        // Blocked: for each channel block, spatial points of an image are
+        // contiguous rows of `blk` channels.
+        for (dim_t ocb = 0; ocb < nb_oc; ocb++) {
+            float *blk_acc = thr_acc + ocb * blk;
+            dim_t iwork = start;
+            while (iwork < end) {
+                const dim_t mb = iwork / SP;
+                const dim_t sp_start = iwork % SP;
+                const dim_t sp_end = nstl::min(SP, sp_start + end - iwork);
+                const ddst_data_t *ptr
+                        = diff_dst + mb * strides[0] + ocb * strides[1];
+                for (dim_t sp = sp_start; sp < sp_end; sp++) {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < blk; i++)
+                        blk_acc[i] += static_cast<float>(ptr[sp * blk + i]);
+                }
+                iwork += sp_end - sp_start;
+            }
+        }
+    });
+
+    parallel_nd(OC, [&](dim_t oc) {
+        float db = 0.f;
+        for (int ithr = 0; ithr < nthr_bias; ithr++)
+            db += acc[ithr * acc_stride + oc];
+        diff_bias[oc] = static_cast<dbia_data_t>(db);
+    });
+}
+
+status_t brgemm_deconvolution_bwd_weights_t::execute(
+        const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    const auto &args = ctx.args();
+    exec_args_t conv_args;
+    conv_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_DIFF_DST);
+    conv_args[DNNL_ARG_DIFF_DST] = args.at(DNNL_ARG_SRC);
+    conv_args[DNNL_ARG_DIFF_WEIGHTS] = args.at(DNNL_ARG_DIFF_WEIGHTS);
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, memory_tracking::names::key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    CHECK(conv_p_->execute(conv_ctx));
+
+    if (!pd()->with_bias()) return status::success;
+
+    const auto ddst_type = pd()->diff_dst_md()->data_type;
+    const auto dbia_type = pd()->diff_weights_md(1)->data_type;
+    if (ddst_type == bf16 && dbia_type == f32)
+        compute_diff_bias<bfloat16_t, float>(ctx);
+    else if (ddst_type == bf16)
+        compute_diff_bias<bfloat16_t, bfloat16_t>(ctx);
+    else if (ddst_type == f16 && dbia_type == f32)
+        compute_diff_bias<float16_t, float>(ctx);
+    else if (ddst_type == f16)
+        compute_diff_bias<float16_t, float16_t>(ctx);
+    else
+        assert(!"unsupported data types");
+
+    return status::success;
+}
+
+template struct brgemm_deconvolution_bwd_data_t<avx2>;
+template struct brgemm_deconvolution_bwd_data_t<avx2_vnni_2>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core_bf16>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core_fp16>;
+template struct brgemm_deconvolution_bwd_data_t<avx10_2_512>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core_amx>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core_amx_fp16>;
+template struct brgemm_deconvolution_bwd_data_t<avx10_2_512_amx_2>;
+
 template struct brgemm_deconvolution_fwd_t<avx2>;
 template struct brgemm_deconvolution_fwd_t<avx2_vnni>;
 template struct brgemm_deconvolution_fwd_t<avx2_vnni_2>;
@@ -28,6 +28,7 @@
 #include "cpu/x64/jit_brgemm_1x1_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_strided.hpp"
+#include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -111,6 +112,114 @@ private:
     std::shared_ptr<primitive_t> conv_p_;
 };
 
+// Deconvolution backward by data is a forward convolution of diff_dst with
+// the weights that have input and output channels swapped. It is executed by
+// a brgemm forward convolution directly on the user buffers.
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_bwd_data_t : public primitive_t {
+
+    struct pd_t : public cpu_deconvolution_bwd_data_pd_t {
+        using cpu_deconvolution_bwd_data_pd_t::cpu_deconvolution_bwd_data_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_deconvolution_bwd_data_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), brgemm_deconvolution_bwd_data_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+
+    private:
+        std::string name_;
+
+        void init_name() {
+            name_ = JIT_IMPL_NAME_HELPER("brg_deconv:", isa, "");
+            name_.append("+");
+            name_.append(conv_pd_->name());
+        }
+    };
+
+    brgemm_deconvolution_bwd_data_t(const pd_t *apd) : primitive_t(apd) {};
+
+    ~brgemm_deconvolution_bwd_data_t() override = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+// Deconvolution backward by weights is a backward by weights convolution with
+// src and diff_dst swapped. The bias gradient is a reduction of diff_dst,
+// which is the convolution source, so it is computed by the deconvolution
+// itself in a single pass over diff_dst in its native layout.
+struct brgemm_deconvolution_bwd_weights_t : public primitive_t {
+
+    struct pd_t : public cpu_deconvolution_bwd_weights_pd_t {
+        using cpu_deconvolution_bwd_weights_pd_t::
+                cpu_deconvolution_bwd_weights_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_deconvolution_bwd_weights_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , bias_blk_(other.bias_blk_)
+            , nthr_bias_(other.nthr_bias_)
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), brgemm_deconvolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        // Number of floats in a per-thread bias accumulator, padded to a
+        // cache line.
+        dim_t bias_acc_stride() const {
+            return utils::rnd_up(utils::rnd_up(OC(), bias_blk_), 16);
+        }
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+        // Channel block of diff_dst, 1 for channels-last layouts.
+        dim_t bias_blk_ = 1;
+        int nthr_bias_ = 1;
+
+    private:
+        std::string name_;
+
+        status_t init_bias_reduction();
+
+        void init_name() {
+            name_ = "brg_deconv:any+";
+            name_.append(conv_pd_->name());
+        }
+    };
+
+    brgemm_deconvolution_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {};
+
+    ~brgemm_deconvolution_bwd_weights_t() override = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    template <typename ddst_data_t, typename dbia_data_t>
+    void compute_diff_bias(const exec_ctx_t &ctx) const;
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -19,6 +19,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/experimental.hpp"
 #include "common/math_utils.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
@@ -66,6 +67,12 @@ struct jit_bnorm_conf_t {
     size_t dt_size_ {0};
     bool is_nspc_ {false};
 
+    // Mean and variance are computed in a single pass over src as
+    // E[x^2] - E[x]^2. The sums of squares are reduced in the second half of
+    // the reduction buffer, `rbuf_sqr_offt_` bytes after the sums.
+    bool stats_one_pass_ {false};
+    size_t rbuf_sqr_offt_ {0};
+
     // thread partition info
     bool do_blocking_ {false};
     bool is_spatial_thr_ {false};
@@ -95,6 +102,9 @@ struct jit_bnorm_conf_t {
         const memory_desc_wrapper src_d(pd_->src_md());
         is_nspc_ = is_nspc(src_d);
 
+        stats_one_pass_ = use_stats_one_pass(pd_);
+        rbuf_sqr_offt_ = C_PADDED * nthr * sizeof(acc_data_t);
+
         size_t data_size = dt_size_ * N * C_PADDED * SP;
         const size_t l3_size = platform::get_per_core_cache_size(3) * nthr;
         // TODO: cache balancing for nspc
@@ -132,6 +142,13 @@ struct jit_bnorm_conf_t {
                     C_nthr_last_iter_, N_nthr_last_iter_, S_nthr_last_iter_);
     }
 
+    static bool use_stats_one_pass(const batch_normalization_pd_t *pd) {
+        return pd->is_fwd() && !pd->stats_is_src()
+                && (utils::one_of(pd->attr()->acc_mode_,
+                            accumulation_mode::relaxed, accumulation_mode::any)
+                        || experimental::use_bnorm_stats_one_pass());
+    }
+
     // given nthr and shape of problem, choose the thread partition
     // to use (ie set N_nthr, C_nthr, and S_nthr)
     bool thread_partition(bool spatial_thr_allowed, int nthr, dim_t N,
@@ -252,6 +269,8 @@ struct jit_bnorm_t : public jit_generator_t {
     bool is_bf16_ = false;
     bool is_f16_ = false;
     bool is_avx2_ne_xf16_ = false;
+    // The avx2_vnni_2 nspc kernel keeps the sums in interleaved order.
+    bool stats_one_pass_ = false;
 
     // set by ctor depending on data type (xF16 or FP32);
     int vlen_spat_data_ = 0;
@@ -724,6 +743,10 @@ struct jit_bnorm_t : public jit_generator_t {
         return vmmword[reg_mean + reg_coff + offt];
     }
 
+    Address rbuf_sqr_ptr(const Reg64 &reg_off, size_t offt = 0) {
+        return vmmword[reg_rbuf1 + reg_off + jbp_->rbuf_sqr_offt_ + offt];
+    }
+
     Address var_ptr(size_t offt = 0) {
         return vmmword[reg_var + reg_coff + offt];
     }
@@ -818,6 +841,47 @@ struct jit_bnorm_t : public jit_generator_t {
         }
     }
 
+    void mean_var_one_pass_channels() {
+        Label ch_label;
+        L(ch_label);
+        {
+            uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
+            uni_vmovups(Vmm(2), rbuf_sqr_ptr(reg_coff));
+            spat_loop(
+                    spat_size, unroll_blocks, unroll_regs,
+                    [this](size_t base_reg) {
+                        Vmm vsum = Vmm(base_reg * 3);
+                        Vmm vsqr = Vmm(base_reg * 3 + 2);
+                        if (base_reg) {
+                            uni_vpxor(vsum, vsum, vsum);
+                            uni_vpxor(vsqr, vsqr, vsqr);
+                        }
+                    },
+                    [this](size_t base_reg, size_t i) {
+                        Vmm vsum = Vmm(base_reg * 3);
+                        Vmm vsrc = Vmm(base_reg * 3 + 1);
+                        Vmm vsqr = Vmm(base_reg * 3 + 2);
+                        size_t offt = i * vlen_spat_data_;
+                        uni_vmovups_spat_data(
+                                vsrc, vmmword[reg_src + reg_soff + offt]);
+                        uni_vaddps(vsum, vsum, vsrc);
+                        uni_vfmadd231ps(vsqr, vsrc, vsrc);
+                    },
+                    [this](size_t base_reg) {
+                        if (base_reg) {
+                            uni_vaddps(Vmm(0), Vmm(0), Vmm(base_reg * 3));
+                            uni_vaddps(Vmm(2), Vmm(2), Vmm(base_reg * 3 + 2));
+                        }
+                    });
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(rbuf_sqr_ptr(reg_coff), Vmm(2));
+
+            add(reg_coff, vlen);
+            cmp(reg_coff, reg_coff_max);
+            jl(ch_label);
+        }
+    }
+
     void mean_variance_nspc(
             const int num_ch_blks, int num_spat_pts, bool compute_mean) {
 
@@ -899,10 +963,30 @@ struct jit_bnorm_t : public jit_generator_t {
             }
         };
 
+        // The sums of squares are accumulated next to the sums.
+        auto mean_var_one_pass_compute = [this](int num_ch_blks,
+                                                 int num_spat_pts) {
+            for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
+                for (int ch_idx = 0; ch_idx < num_ch_blks; ++ch_idx) {
+                    const int offt = ch_idx * vlen_spat_data_;
+                    const Vmm vsrc = vtmp;
+                    const Vmm vsqr_ch = Vmm(ch_idx + num_ch_blks);
+                    uni_vmovups_spat_data(
+                            vsrc, vmmword[reg_src + reg_soff_nspc + offt]);
+                    uni_vaddps(Vmm(ch_idx), Vmm(ch_idx), vsrc);
+                    uni_vfmadd231ps(vsqr_ch, vsrc, vsrc);
+                }
+                add(reg_soff_nspc, spat_step);
+            }
+        };
+
         for (int idx = 0; idx < num_ch_blks; ++idx) {
             const int coff = idx * vlen;
             uni_vmovups(Vmm(idx), vmmword[reg_rbuf1 + reg_coff + coff]);
-            if (!compute_mean) {
+            if (stats_one_pass_) {
+                uni_vmovups(
+                        Vmm(idx + num_ch_blks), rbuf_sqr_ptr(reg_coff, coff));
+            } else if (!compute_mean) {
                 // pre-load mean to avoid extra data movement during variance
                 const Vmm vmean_ch = Vmm(idx + num_ch_blks);
                 uni_vmovups_maybe_tail(vmean_ch, mean_ptr(coff));
@@ -926,7 +1010,9 @@ struct jit_bnorm_t : public jit_generator_t {
         Label spatial;
         L(spatial);
         {
-            if (is_avx2_ne_xf16_)
+            if (stats_one_pass_)
+                mean_var_one_pass_compute(num_ch_blks, num_spat_pts);
+            else if (is_avx2_ne_xf16_)
                 compute_mean
                         ? mean_compute_avx2_ne_xf16(num_ch_blks, num_spat_pts)
                         : variance_compute_avx2_ne_xf16(
@@ -941,6 +1027,9 @@ struct jit_bnorm_t : public jit_generator_t {
         for (int idx = 0; idx < num_ch_blks; ++idx) {
             const int coff = idx * vlen;
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff + coff], Vmm(idx));
+            if (stats_one_pass_)
+                uni_vmovups(
+                        rbuf_sqr_ptr(reg_coff, coff), Vmm(idx + num_ch_blks));
         }
     }
 
@@ -1172,6 +1261,7 @@ struct jit_bnorm_t : public jit_generator_t {
         L(zero_rbuf);
         {
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            if (stats_one_pass_) uni_vmovups(rbuf_sqr_ptr(reg_coff), Vmm(0));
             add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
             cmp(reg_coff, reg_coff_max);
             jne(zero_rbuf);
@@ -1187,14 +1277,22 @@ struct jit_bnorm_t : public jit_generator_t {
 
             if (isa == sse41) mov(reg_tmp_off, reg_soff);
 
-            jbp_->is_nspc_ ? compute_mean_variance_nspc() : mean_channels();
+            if (jbp_->is_nspc_)
+                compute_mean_variance_nspc();
+            else if (stats_one_pass_)
+                mean_var_one_pass_channels();
+            else
+                mean_channels();
 
             if (isa == sse41) {
                 mov(reg_soff, reg_tmp_off);
                 add(reg_src, vlen / 2);
                 mov(reg_coff, vlen / 2);
 
-                mean_channels();
+                if (stats_one_pass_)
+                    mean_var_one_pass_channels();
+                else
+                    mean_channels();
 
                 sub(reg_src, vlen / 2);
             }
@@ -1214,6 +1312,11 @@ struct jit_bnorm_t : public jit_generator_t {
 
         if (jbp_->is_nspc_) mov(reg_src, ptr[rsp + stack_off_src]); // comeback
 
+        if (stats_one_pass_) {
+            mean_var_one_pass_reduction();
+            return;
+        }
+
         Label no_mean_reduction;
         barrier();
         {
@@ -1320,6 +1423,50 @@ struct jit_bnorm_t : public jit_generator_t {
         barrier();
     }
 
+    // Reduces the per-thread sums and sums of squares at once:
+    // mean = S / n, var = max(0, Q / n - mean^2).
+    void mean_var_one_pass_reduction() {
+        Label no_reduction;
+        barrier();
+        {
+            mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
+            cmp(reg_tmp, 0);
+            jne(no_reduction);
+            mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
+            xor_(reg_coff, reg_coff);
+            Label reduction_channels;
+            L(reduction_channels);
+            {
+                mov(reg_roff, reg_coff);
+                uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
+                uni_vpxor(Vmm(2), Vmm(2), Vmm(2));
+                mov(reg_ctr, reg_nnthr);
+                Label reduction_thrs;
+                L(reduction_thrs);
+                {
+                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf1 + reg_roff]);
+                    uni_vaddps(Vmm(2), Vmm(2), rbuf_sqr_ptr(reg_roff));
+                    add(reg_roff, reg_coff_max);
+                    sub(reg_ctr, 1);
+                    jnz(reduction_thrs);
+                }
+                uni_vdivps(Vmm(1), Vmm(1), vchan_size);
+                uni_vdivps(Vmm(2), Vmm(2), vchan_size);
+                uni_vmovups_maybe_tail(mean_ptr(), Vmm(1));
+                uni_vfnmadd231ps(Vmm(2), Vmm(1), Vmm(1), Vmm(3));
+                uni_vpxor(Vmm(3), Vmm(3), Vmm(3));
+                uni_vmaxps(Vmm(2), Vmm(2), Vmm(3));
+                uni_vmovups_maybe_tail(var_ptr(), Vmm(2));
+
+                add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
+                cmp(reg_coff, reg_coff_max);
+                jl(reduction_channels);
+            }
+        }
+        L(no_reduction);
+        barrier();
+    }
+
     void forward_channels() {
         Label ch_label;
         L(ch_label);
@@ -2086,6 +2233,8 @@ struct jit_bnorm_t : public jit_generator_t {
         , unroll_regs(isa == avx512_core && !jbp_->is_spatial_thr_ ? 4 : 1) {
         static_assert(isa == sse41 || isa == avx2 || isa == avx512_core,
                 "unsupported isa");
+        stats_one_pass_ = jbp_->stats_one_pass_
+                && !(is_avx2_ne_xf16_ && jbp_->is_nspc_);
     }
 
     void generate() override {
@@ -2142,7 +2291,9 @@ struct driver_t : public c_compatible {
         auto sbuf_sz = use_tmp_stats(pd) * 2 * C_PADDED;
         auto pbuf_sz
                 = (use_tmp_diff_scale(pd) + use_tmp_diff_shift(pd)) * C_PADDED;
-        auto rbuf_sz = (pd->is_fwd() ? 1 : 2) * C_PADDED * nthr;
+        const bool stats_one_pass = jit_bnorm_conf_t::use_stats_one_pass(pd);
+        auto rbuf_sz = (pd->is_fwd() && !stats_one_pass ? 1 : 2) * C_PADDED
+                * nthr;
 
         scratchpad.book<acc_data_t>(key_bnorm_tmp_stats, sbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_tmp_diff_ss, pbuf_sz);
@@ -217,8 +217,9 @@ struct jit_uni_dw_convolution_bwd_weights_t : public primitive_t {
                                     bf16)),
                     VERBOSE_UNSUPPORTED_BIAS_CFG);
 
-            const int max_threads
-                    = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+            const int max_threads = dnnl_in_parallel_without_budget()
+                    ? 1
+                    : dnnl_get_max_threads();
 
             // TODO: make `init_conf` assign initialized object to `jcp_`
             using jit_uni_dw_conv_bwd_weights_kernel_inst
@@ -17,6 +17,7 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -51,12 +52,15 @@ cpu_isa_t get_io_isa(cpu_isa_t isa, bool has_f16, bool has_bf16) {
         return isa;
 }
 
-const bcast_set_t &get_supported_bcast_strategies() {
-    // Group norm processes a single group of channels so far. Because of that,
-    // the offset per channel must be passed to the kernel but current binary po
-    // logic prevents doing it in scalable way. Keeping only `common` for now.
+const bcast_set_t &get_supported_bcast_strategies(bool per_channel) {
+    // When a single group of channels is processed, the offset per channel
+    // must be passed to the kernel but current binary po logic prevents doing
+    // it in scalable way. Keeping only `common` for this case. Full rows of
+    // channels processed with per-channel stats allow `per_oc` as well.
     static const bcast_set_t set_group_norm {broadcasting_strategy_t::scalar};
-    return set_group_norm;
+    static const bcast_set_t set_per_channel {
+            broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc};
+    return per_channel ? set_per_channel : set_group_norm;
 }
 
 template <cpu_isa_t isa>
@@ -64,16 +68,17 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
                   public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_group_normalization_fwd_t::kernel_t);
 
-    kernel_t(const group_normalization_pd_t *pd)
+    kernel_t(const jit_uni_group_normalization_fwd_t::pd_t *pd)
         : jit_uni_group_normalization_fwd_t::kernel_base_t(pd)
         , jit_generator_t(jit_name(), isa)
         , src_d_(pd->src_md())
         , dst_d_(pd->dst_md())
         , C_(pd->C())
         , C_PER_G_(pd->C() / pd->G())
+        , per_channel_(pd->per_channel_)
         , simd_w_(vlen / sizeof(float))
-        , axis_simd_full_(C_PER_G_ / simd_w_)
-        , axis_simd_tail_(C_PER_G_ % simd_w_)
+        , axis_simd_full_((per_channel_ ? C_ : C_PER_G_) / simd_w_)
+        , axis_simd_tail_((per_channel_ ? C_ : C_PER_G_) % simd_w_)
         , use_scale_(pd->use_scale())
         , use_shift_(pd->use_shift())
         , eps_(pd->desc()->group_norm_epsilon) {
@@ -105,11 +110,12 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
 
         VDEBUGINFO(1, primitive, group_normalization,
                 "%s:\n    C_=%" PRId64 "\n    C_PER_G_=%" PRId64
+                "\n    per_channel_=%d"
                 "\n    simd_w_=%zu\n    axis_simd_full_=%" PRId64
                 "\n    axis_simd_tail_=%" PRId64
                 "\n    use_scale_=%d\n    use_shift_=%d",
-                jit_name(), C_, C_PER_G_, simd_w_, axis_simd_full_,
-                axis_simd_tail_, use_scale_, use_shift_);
+                jit_name(), C_, C_PER_G_, per_channel_, simd_w_,
+                axis_simd_full_, axis_simd_tail_, use_scale_, use_shift_);
     }
 
     status_t create_kernel() override {
@@ -140,7 +146,8 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
                     use_exact_tail_scalar_bcast};
 
             const binary_injector::static_params_t bsp {
-                    reg_param, get_supported_bcast_strategies(), rhs_sp};
+                    reg_param, get_supported_bcast_strategies(per_channel_),
+                    rhs_sp};
 
             postops_injector_ = utils::make_unique<
                     injector::jit_uni_postops_injector_t<isa>>(
@@ -246,6 +253,7 @@ protected:
     const memory_desc_wrapper src_d_, dst_d_;
     const dim_t C_;
     const dim_t C_PER_G_;
+    const bool per_channel_;
     const size_t simd_w_;
     const dim_t axis_simd_full_;
     const dim_t axis_simd_tail_;
@@ -270,9 +278,15 @@ protected:
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
 
-        // Broadcasting a single mean and var value per group.
-        io_[f32]->broadcast(mean_ptr(0), vmm_mean);
-        io_[f32]->broadcast(var_ptr(0), vmm_inv_sqrtvar);
+        if (per_channel_) {
+            // Loading as many stats as vector can hold.
+            io_[f32]->load(mean_ptr(offt_elems), vmm_mean, tail);
+            io_[f32]->load(var_ptr(offt_elems), vmm_inv_sqrtvar, tail);
+        } else {
+            // Broadcasting a single mean and var value per group.
+            io_[f32]->broadcast(mean_ptr(0), vmm_mean);
+            io_[f32]->broadcast(var_ptr(0), vmm_inv_sqrtvar);
+        }
 
         // calculate inv_sqrtvar
         uni_vaddps(vmm_inv_sqrtvar, vmm_inv_sqrtvar, vmm_eps);
@@ -391,18 +405,23 @@ struct kernel_stat_t
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_group_normalization_fwd_t::kernel_stat_t);
 
-    kernel_stat_t(const group_normalization_pd_t *pd, bool compute_var = false)
+    kernel_stat_t(const jit_uni_group_normalization_fwd_t::pd_t *pd,
+            bool compute_var = false)
         : jit_generator_t(jit_name())
         , src_d_(pd->src_md())
         , compute_var_(compute_var)
+        , single_pass_(pd->single_pass_stats_)
+        , per_channel_(pd->per_channel_)
         , C_(pd->C())
         , C_PER_G_(C_ / pd->G())
         , SP_(pd->D() * pd->H() * pd->W())
         , simd_w_(vlen / sizeof(float))
-        , axis_simd_tail_(C_PER_G_ % simd_w_)
+        , axis_simd_tail_((per_channel_ ? C_ : C_PER_G_) % simd_w_)
+        , unroll_c_(single_pass_ ? 3 : 4)
         , c_block_(unroll_c_ * simd_w_)
-        , nc_blocks_(C_PER_G_ / c_block_)
-        , c_block_tail_((C_PER_G_ % c_block_) - axis_simd_tail_)
+        , nc_blocks_((per_channel_ ? C_ : C_PER_G_) / c_block_)
+        , c_block_tail_(((per_channel_ ? C_ : C_PER_G_) % c_block_)
+                  - axis_simd_tail_)
         , unroll_c_tail_(c_block_tail_ / simd_w_) {
 
         io::io_conf_t io_conf;
@@ -424,15 +443,16 @@ struct kernel_stat_t
                 this, io_isa, {f32}, io_conf, io_tail_conf_stats);
 
         VDEBUGINFO(1, primitive, group_normalization,
-                "%s:\n    compute_var_=%d\n    C_=%" PRId64
+                "%s:\n    compute_var_=%d\n    single_pass_=%d"
+                "\n    per_channel_=%d\n    C_=%" PRId64
                 "\n    C_PER_G_=%" PRId64
                 "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
                 "\n    unroll_c_=%" PRId64 "\n    c_block_=%" PRId64
                 "\n    nc_blocks_=%" PRId64 "\n    c_block_tail_=%" PRId64
                 "\n    unroll_c_tail_=%" PRId64,
-                jit_name(), compute_var_, C_, C_PER_G_, simd_w_,
-                axis_simd_tail_, unroll_c_, c_block_, nc_blocks_, c_block_tail_,
-                unroll_c_tail_);
+                jit_name(), compute_var_, single_pass_, per_channel_, C_,
+                C_PER_G_, simd_w_, axis_simd_tail_, unroll_c_, c_block_,
+                nc_blocks_, c_block_tail_, unroll_c_tail_);
     }
 
     status_t create_kernel() override {
@@ -447,10 +467,17 @@ struct kernel_stat_t
 
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
-        if (compute_var_) mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+        if (compute_var_ || single_pass_)
+            mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+        if (single_pass_) mov(reg_pivot, ptr[reg_param + PARAM_OFF(pivot)]);
         mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
 #undef PARAM_OFF
 
+        // A group shares a single pivot, the first element of the group, so
+        // that shifted sums can be reduced across registers.
+        if (single_pass_ && !per_channel_)
+            io_[src_d_.data_type()]->broadcast(ptr[reg_src_start], vmm_pivot);
+
         // Initializing registers for unrolling and further reduction of those
         // is called with the maximum unroll value of a `compute_stat_block`
         // function as they operate over vmms, which numeration depends on
@@ -459,15 +486,9 @@ struct kernel_stat_t
                 : unroll_c_tail_             ? unroll_c_tail_
                                              : 1;
 
-        if (!compute_var_) {
-            for (size_t ur = 0; ur < max_unroll; ur++) {
-                uni_vpxor(Vmm_mean(ur), Vmm_mean(ur), Vmm_mean(ur));
-            }
-        } else {
-            for (size_t ur = 0; ur < max_unroll; ur++) {
-                uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
-            }
-        }
+        // Per-channel statistics are stored after each block, while group
+        // ones are accumulated across blocks.
+        if (!per_channel_) zero_stat_registers(max_unroll);
 
         if (nc_blocks_) {
             xor_(reg_nc_block, reg_nc_block);
@@ -481,8 +502,7 @@ struct kernel_stat_t
                 // calculate mean
                 compute_stat_block(unroll_c_);
 
-                add(reg_src_start,
-                        c_block_ * types::data_type_size(src_d_.data_type()));
+                advance_channels(c_block_);
                 add(reg_nc_block, 1);
 
                 jmp(c_blk_loop);
@@ -492,58 +512,12 @@ struct kernel_stat_t
 
         if (unroll_c_tail_) {
             compute_stat_block(unroll_c_tail_);
-            add(reg_src_start,
-                    c_block_tail_ * types::data_type_size(src_d_.data_type()));
+            advance_channels(c_block_tail_);
         }
 
         if (axis_simd_tail_) compute_stat_block(1, true);
 
-        // Reduction on registers for Group normalization as the kernel
-        // processes a single group at a time.
-
-        // Part 1 is reducing over unrolled registers.
-        const Vmm &vmm_stat = !compute_var_ ? vmm_mean : vmm_var;
-
-        Vmm vmm_tmp_max0 = !compute_var_ ? Vmm_mean(0) : Vmm_var(0);
-        Vmm vmm_tmp_max1 = !compute_var_ ? Vmm_mean(1) : Vmm_var(1);
-        Vmm vmm_tmp_max2 = !compute_var_ ? Vmm_mean(2) : Vmm_var(2);
-        Vmm vmm_tmp_max3 = !compute_var_ ? Vmm_mean(3) : Vmm_var(3);
-
-        switch (max_unroll) {
-            case 4: {
-                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
-                uni_vaddps(vmm_tmp_max2, vmm_tmp_max2, vmm_tmp_max3);
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
-            } break;
-            case 3: {
-                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
-            } break;
-            case 2: {
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max1);
-            } break;
-            case 1: {
-                uni_vmovups(vmm_stat, vmm_tmp_max0);
-            } break;
-            default: break;
-        }
-
-        // Part 2 is to reduce within a single register.
-        reduce_horizontal(vmm_stat, vmm_tmp);
-
-        // Divide a stat by N.
-        // Note: the behavior is aligned with with kernel execution model.
-        //   Check for `SINGLE_KERNEL_HEURISTIC_ANCHOR` for a pairing spot.
-        if (C_PER_G_ >= 32) {
-            mov(reg_tmp, float2int(C_PER_G_ * SP_));
-            uni_vmovq(xmm_tmp, reg_tmp);
-            uni_vbroadcastss(vmm_tmp, xmm_tmp);
-            uni_vdivps(vmm_stat, vmm_stat, vmm_tmp);
-        }
-
-        io_stat_.prepare_tail_mask();
-        const auto &stat_addr = !compute_var_ ? mean_ptr(0) : var_ptr(0);
-        io_stat_[f32]->store(vmm_stat, stat_addr, true);
+        if (!per_channel_) reduce_group_stats(max_unroll);
 
         postamble();
     }
@@ -571,6 +545,19 @@ struct kernel_stat_t
         jit_generator_t::operator()(&args);
     }
 
+    void operator()(const void *src, float *mean, float *var, float *pivot,
+            size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.mean = mean;
+        args.var = var;
+        args.pivot = pivot;
+        args.block_size
+                = block_size * C_ * types::data_type_size(src_d_.data_type());
+
+        jit_generator_t::operator()(&args);
+    }
+
 protected:
     using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
     const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
@@ -582,17 +569,22 @@ protected:
         const void *src;
         const float *mean;
         const float *var;
+        const float *pivot;
         size_t block_size;
     };
 
     const memory_desc_wrapper src_d_;
     const bool compute_var_;
+    const bool single_pass_;
+    const bool per_channel_;
     const dim_t C_;
     const dim_t C_PER_G_;
     const dim_t SP_;
     const size_t simd_w_;
     const dim_t axis_simd_tail_;
-    static constexpr dim_t unroll_c_ = 4;
+    // Single pass keeps a pivot per unrolled register on top of two stats and
+    // a source, which doesn't fit avx2 register file with an unroll of 4.
+    const dim_t unroll_c_;
     const dim_t c_block_;
     const dim_t nc_blocks_;
     const dim_t c_block_tail_;
@@ -602,6 +594,25 @@ protected:
     // `io_stat_` is to store a single element of mean or var.
     io::jit_io_multi_dt_helper_t<Vmm> io_stat_;
 
+    void zero_stat_registers(size_t unroll) {
+        for (size_t ur = 0; ur < unroll; ur++) {
+            if (!compute_var_ || single_pass_)
+                uni_vpxor(Vmm_mean(ur), Vmm_mean(ur), Vmm_mean(ur));
+            if (compute_var_ || single_pass_)
+                uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
+        }
+    }
+
+    void advance_channels(dim_t nchannels) {
+        add(reg_src_start, nchannels * src_d_.data_type_size());
+        if (!per_channel_) return;
+
+        add(reg_mean, nchannels * sizeof(float));
+        if (compute_var_ || single_pass_)
+            add(reg_var, nchannels * sizeof(float));
+        if (single_pass_) add(reg_pivot, nchannels * sizeof(float));
+    }
+
     void reduce_horizontal(const Vmm &vstat, const Vmm &vtmp) {
         if (is_superset(isa, avx512_core)) {
             const Zmm &zstat = Zmm(vstat.getIdx());
@@ -624,12 +635,93 @@ protected:
         uni_vaddps(vstat, vstat, vtmp);
     }
 
+    // Reduction on registers for Group normalization as the kernel processes
+    // a single group at a time.
+    void reduce_unrolled(const Vmm &vmm_stat, bool var, size_t max_unroll) {
+        // Part 1 is reducing over unrolled registers.
+        Vmm vmm_tmp_max0 = !var ? Vmm_mean(0) : Vmm_var(0);
+        Vmm vmm_tmp_max1 = !var ? Vmm_mean(1) : Vmm_var(1);
+        Vmm vmm_tmp_max2 = !var ? Vmm_mean(2) : Vmm_var(2);
+        Vmm vmm_tmp_max3 = !var ? Vmm_mean(3) : Vmm_var(3);
+
+        switch (max_unroll) {
+            case 4: {
+                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
+                uni_vaddps(vmm_tmp_max2, vmm_tmp_max2, vmm_tmp_max3);
+                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
+            } break;
+            case 3: {
+                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
+                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
+            } break;
+            case 2: {
+                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max1);
+            } break;
+            case 1: {
+                uni_vmovups(vmm_stat, vmm_tmp_max0);
+            } break;
+            default: break;
+        }
+
+        // Part 2 is to reduce within a single register.
+        reduce_horizontal(vmm_stat, vmm_tmp);
+    }
+
+    void reduce_group_stats(size_t max_unroll) {
+        const bool with_mean = !compute_var_ || single_pass_;
+        const bool with_var = compute_var_ || single_pass_;
+        if (with_mean) reduce_unrolled(vmm_mean, false, max_unroll);
+        if (with_var) reduce_unrolled(vmm_var, true, max_unroll);
+
+        // Divide a stat by N.
+        // Note: the behavior is aligned with with kernel execution model.
+        //   Check for `SINGLE_KERNEL_HEURISTIC_ANCHOR` for a pairing spot.
+        const bool finalize = C_PER_G_ >= 32;
+        if (finalize) {
+            mov(reg_tmp, float2int(C_PER_G_ * SP_));
+            uni_vmovq(xmm_tmp, reg_tmp);
+            uni_vbroadcastss(vmm_tmp, xmm_tmp);
+            if (with_mean) uni_vdivps(vmm_mean, vmm_mean, vmm_tmp);
+            if (with_var) uni_vdivps(vmm_var, vmm_var, vmm_tmp);
+            if (single_pass_) {
+                // var = E[(x - p)^2] - E[x - p]^2 and mean = p + E[x - p].
+                uni_vfnmadd231ps(vmm_var, vmm_mean, vmm_mean);
+                uni_vaddps(vmm_mean, vmm_mean, vmm_pivot);
+            }
+        }
+
+        io_stat_.prepare_tail_mask();
+        if (with_mean) io_stat_[f32]->store(vmm_mean, mean_ptr(0), true);
+        if (with_var) io_stat_[f32]->store(vmm_var, var_ptr(0), true);
+        if (single_pass_ && !finalize)
+            io_stat_[f32]->store(vmm_pivot, pivot_ptr(0), true);
+    }
+
+    // Subtracts `vmm_sub` from `vmm_src` keeping zeros in tail lanes where
+    // there's no data. Otherwise, accumulating towards a group stat will spoil
+    // the right answer.
+    void sub_tail(const Vmm &vmm_src, const Vmm &vmm_sub, bool tail) {
+        if (!tail || per_channel_)
+            uni_vsubps(vmm_src, vmm_src, vmm_sub);
+        else if (is_superset(isa, avx512_core)) {
+            uni_vsubps(vmm_src | tail_opmask, vmm_src, vmm_sub);
+        } else if (is_superset(isa, avx)) {
+            // Use a scratch zeroed register to keep stats properly computed.
+            uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
+            uni_vblendvps(vmm_tmp, vmm_tmp, vmm_sub, vmm_tail_mask);
+            uni_vsubps(vmm_src, vmm_src, vmm_tmp);
+        } else {
+            assert(!"unsupported isa");
+        }
+    }
+
     void compute_mean_block(size_t unroll, bool tail = false) {
         const size_t c_src_size
                 = C_ * types::data_type_size(src_d_.data_type());
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
 #undef PARAM_OFF
+        if (per_channel_) zero_stat_registers(unroll);
 
         mov(reg_src, reg_src_start);
         // add block_start to block_size to define block_end
@@ -651,6 +743,11 @@ protected:
             jmp(sp_blk_loop);
         }
         L(sp_blk_loop_end);
+
+        if (per_channel_) {
+            for (size_t ur = 0; ur < unroll; ur++)
+                io_[f32]->store(Vmm_mean(ur), mean_ptr(ur * simd_w_), tail);
+        }
     }
 
     void compute_var_block(size_t unroll, bool tail = false) {
@@ -659,8 +756,12 @@ protected:
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
 #undef PARAM_OFF
+        if (per_channel_) zero_stat_registers(unroll);
         for (size_t ur = 0; ur < unroll; ur++) {
-            io_[data_type::f32]->broadcast(mean_ptr(0), Vmm_mean(ur));
+            if (per_channel_)
+                io_[f32]->load(mean_ptr(ur * simd_w_), Vmm_mean(ur), tail);
+            else
+                io_[f32]->broadcast(mean_ptr(0), Vmm_mean(ur));
         }
 
         mov(reg_src, reg_src_start);
@@ -678,28 +779,63 @@ protected:
                         src_ptr(ur * simd_w_), Vmm_src(ur), tail);
             }
             for (size_t ur = 0; ur < unroll; ur++) {
-                if (!tail)
-                    uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_mean(ur));
-                else {
-                    // Subtract with mask to keep zeros in spots where there's
-                    // no data. Otherwise, subtracting mean and accumulating
-                    // towards variance will spoil the right answer.
-                    if (is_superset(isa, avx512_core)) {
-                        uni_vsubps(Vmm_src(ur) | tail_opmask, Vmm_src(ur),
-                                Vmm_mean(ur));
-                    } else if (is_superset(isa, avx)) {
-                        // Use a scratch zeroed register to keep stats properly
-                        // computed.
-                        uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
-                        uni_vblendvps(Vmm_mean(ur), vmm_tmp, Vmm_mean(ur),
-                                vmm_tail_mask);
-                        uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_mean(ur));
-                    } else {
-                        assert(!"unsupported isa");
-                    }
-                }
+                sub_tail(Vmm_src(ur), Vmm_mean(ur), tail);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                uni_vfmadd231ps(Vmm_var(ur), Vmm_src(ur), Vmm_src(ur));
+            }
+
+            add(reg_src, c_src_size);
+            jmp(sp_blk_loop);
+        }
+        L(sp_blk_loop_end);
+
+        if (per_channel_) {
+            for (size_t ur = 0; ur < unroll; ur++)
+                io_[f32]->store(Vmm_var(ur), var_ptr(ur * simd_w_), tail);
+        }
+    }
+
+    // Accumulates sums of `src - pivot` and of its squares in a single sweep.
+    // With a pivot close to the mean, the variance recovered from these sums
+    // doesn't suffer from cancellation the way raw sums of squares do.
+    void compute_mean_var_block(size_t unroll, bool tail = false) {
+        const size_t c_src_size
+                = C_ * types::data_type_size(src_d_.data_type());
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+        mov(reg_src, reg_src_start);
+
+        if (per_channel_) {
+            // The first row of the block serves as a per-channel pivot. The
+            // driver never calls the kernel for an empty block.
+            zero_stat_registers(unroll);
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[src_d_.data_type()]->load(
+                        src_ptr(ur * simd_w_), Vmm_pivot(ur), tail);
+                io_[f32]->store(Vmm_pivot(ur), pivot_ptr(ur * simd_w_), tail);
+            }
+        }
+
+        // add block_start to block_size to define block_end
+        add(reg_sp_block_end, reg_src);
+
+        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
+        L(sp_blk_loop);
+        {
+            cmp(reg_sp_block_end, reg_src);
+            jle(sp_blk_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[src_d_.data_type()]->load(
+                        src_ptr(ur * simd_w_), Vmm_src(ur), tail);
             }
             for (size_t ur = 0; ur < unroll; ur++) {
+                sub_tail(Vmm_src(ur), Vmm_pivot(ur), tail);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                uni_vaddps(Vmm_mean(ur), Vmm_mean(ur), Vmm_src(ur));
                 uni_vfmadd231ps(Vmm_var(ur), Vmm_src(ur), Vmm_src(ur));
             }
 
@@ -707,9 +843,19 @@ protected:
             jmp(sp_blk_loop);
         }
         L(sp_blk_loop_end);
+
+        if (per_channel_) {
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[f32]->store(Vmm_mean(ur), mean_ptr(ur * simd_w_), tail);
+                io_[f32]->store(Vmm_var(ur), var_ptr(ur * simd_w_), tail);
+            }
+        }
     }
+
     void compute_stat_block(size_t unroll, bool tail = false) {
-        if (compute_var_)
+        if (single_pass_)
+            compute_mean_var_block(unroll, tail);
+        else if (compute_var_)
             compute_var_block(unroll, tail);
         else
             compute_mean_block(unroll, tail);
@@ -718,6 +864,10 @@ protected:
     Vmm Vmm_mean(size_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
     Vmm Vmm_var(size_t ur = 0) { return Vmm(1 + 1 * unroll_c_ + ur); }
     Vmm Vmm_src(size_t ur = 0) { return Vmm(1 + 2 * unroll_c_ + ur); }
+    // A group pivot is shared by all unrolled registers.
+    Vmm Vmm_pivot(size_t ur = 0) {
+        return per_channel_ ? Vmm(1 + 3 * unroll_c_ + ur) : vmm_pivot;
+    }
 
     Xbyak::Address src_ptr(size_t offt = 0) {
         return vmmword[reg_src + offt * src_d_.data_type_size()];
@@ -731,6 +881,10 @@ protected:
         return vmmword[reg_var + offt * sizeof(float)];
     }
 
+    Xbyak::Address pivot_ptr(size_t offt = 0) {
+        return vmmword[reg_pivot + offt * sizeof(float)];
+    }
+
     const Xbyak::Reg64 reg_param = abi_param1;
     const Xbyak::Reg64 reg_src = rdx;
     const Xbyak::Reg64 reg_src_start = rax;
@@ -739,8 +893,11 @@ protected:
     const Xbyak::Reg64 reg_nc_block = r10;
     const Xbyak::Reg64 reg_tmp = r11;
     const Xbyak::Reg64 reg_var = r12;
+    const Xbyak::Reg64 reg_pivot = r13;
 
     const Vmm vmm_tail_mask = Vmm(0);
+    // Used only for groups, when per-channel pivot registers are not.
+    const Vmm vmm_pivot = Vmm(10);
     const Vmm vmm_tmp = Vmm(13);
     const Xmm xmm_tmp = Xmm(13);
     const Vmm vmm_var = Vmm(14);
@@ -758,101 +915,655 @@ protected:
 template struct kernel_stat_t<avx2>;
 template struct kernel_stat_t<avx512_core>;
 
-} // namespace
-
-jit_uni_group_normalization_fwd_t::kernel_base_t *
-jit_uni_group_normalization_fwd_t::kernel_base_t::create(
-        const group_normalization_pd_t *pd) {
-    if (mayiuse(avx512_core)) {
-        return new kernel_t<avx512_core>(pd);
-    } else if (mayiuse(avx2)) {
-        return new kernel_t<avx2>(pd);
-    } else {
-        assert(!"kernel is empty.");
-        return nullptr;
-    }
+// Backward kernels process `c_block` channels of a row and iterate over
+// `block_size` rows with a stride of `c_block` elements. It covers both
+// channels-last formats, where a row is a full set of channels, and blocked
+// formats, where a row is a single channel block.
+dim_t get_bwd_c_block(const memory_desc_wrapper &src_d) {
+    const auto &blk = src_d.blocking_desc();
+    return blk.inner_nblks == 1 ? blk.inner_blks[0] : src_d.padded_dims()[1];
 }
 
-jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
-jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(
-        const group_normalization_pd_t *apd, bool compute_var) {
-    if (mayiuse(avx512_core)) {
-        return new kernel_stat_t<avx512_core>(apd, compute_var);
-    } else if (mayiuse(avx2)) {
-        return new kernel_stat_t<avx2>(apd, compute_var);
-    } else {
-        assert(!"kernel is empty.");
-        return nullptr;
-    }
-}
+template <cpu_isa_t isa>
+struct diff_ss_kernel_t
+    : public jit_uni_group_normalization_bwd_t::diff_ss_kernel_base_t,
+      public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_uni_group_normalization_bwd_t::diff_ss_kernel_t);
 
-status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
-    using namespace data_type;
-    using namespace format_tag;
-    using skip_mask_t = primitive_attr_t::skip_mask_t;
+    diff_ss_kernel_t(const jit_uni_group_normalization_bwd_t::pd_t *pd)
+        : jit_generator_t(jit_name(), isa)
+        , src_d_(pd->src_md())
+        , diff_dst_d_(pd->diff_dst_md())
+        , C_block_(pd->c_block())
+        , simd_w_(vlen / sizeof(float))
+        , axis_simd_tail_(C_block_ % simd_w_)
+        , c_block_(unroll_c_ * simd_w_)
+        , nc_blocks_(C_block_ / c_block_)
+        , c_block_tail_((C_block_ % c_block_) - axis_simd_tail_)
+        , unroll_c_tail_(c_block_tail_ / simd_w_) {
 
-    const memory_desc_wrapper src_d(src_md());
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa,
+                utils::one_of(f16, src_d_.data_type(), diff_dst_d_.data_type()),
+                utils::one_of(
+                        bf16, src_d_.data_type(), diff_dst_d_.data_type()));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_d_.data_type(), diff_dst_d_.data_type(),
+                        f32 /* stats */},
+                io_conf, io_tail_conf, io_bf16_conf);
 
-    VDISPATCH_GNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
-    VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
-    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
-    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8),
-            VERBOSE_UNSUPPORTED_DT);
-    VDISPATCH_GNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
-            VERBOSE_UNSUPPORTED_DT);
-    VDISPATCH_GNORM(IMPLICATION(utils::one_of(bf16, src_md()->data_type,
-                                        dst_md()->data_type),
-                            mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
-            VERBOSE_ISA_DT_MISMATCH);
-    VDISPATCH_GNORM(IMPLICATION(utils::one_of(f16, src_md()->data_type,
-                                        dst_md()->data_type),
-                            mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
-            VERBOSE_ISA_DT_MISMATCH);
-    VDISPATCH_GNORM(attr()->has_default_values(
-                            skip_mask_t::scales | skip_mask_t::post_ops),
-            VERBOSE_UNSUPPORTED_ATTR);
-    VDISPATCH_GNORM(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
-    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
-    VDISPATCH_GNORM(
-            memory_desc_matches_one_of_tag(*src_md(), ndhwc, nhwc, nwc, nc),
-            VERBOSE_UNSUPPORTED_TAG_S, "src");
-    VDISPATCH_GNORM(
-            memory_desc_matches_one_of_tag(*dst_md(), ndhwc, nhwc, nwc, nc),
-            VERBOSE_UNSUPPORTED_TAG_S, "dst");
-    VDISPATCH_GNORM(impl::is_dense_format_kind({src_md(), dst_md()}),
-            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+        VDEBUGINFO(1, primitive, group_normalization,
+                "%s:\n    C_block_=%" PRId64
+                "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
+                "\n    unroll_c_=%" PRId64 "\n    nc_blocks_=%" PRId64
+                "\n    unroll_c_tail_=%" PRId64,
+                jit_name(), C_block_, simd_w_, axis_simd_tail_, unroll_c_,
+                nc_blocks_, unroll_c_tail_);
+    }
 
-    // Instance Normalization is handled in a different implementation. This
-    // implementation has some turns in the kernel that is done differently
-    // due to processing a group and not having an ability to process full
-    // registers of channels.
-    // It has also some dispatching logic in parallelization to process groups
-    // differently, see the comment in a correspondent section.
-    const size_t C_PER_G = C() / G();
-    VDISPATCH_GNORM(C_PER_G > 1, "Instance norm is not supported");
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
 
-    auto post_ops_ok = [&]() -> bool {
-        const std::vector<injector::post_op_type> accepted_post_ops
-                = {injector::eltwise, injector::binary, injector::sum};
-        const memory_desc_wrapper dst_d(dst_md());
-        injector::post_ops_ok_args_t post_ops_args(get_supported_isa(),
-                accepted_post_ops, attr()->post_ops_, &dst_d, true, true, true,
-                true, get_supported_bcast_strategies());
+    void generate() override {
+        preamble();
 
-        return injector::post_ops_ok(post_ops_args);
-    };
-    VDISPATCH_GNORM(attr_.set_default_formats(dst_md(0)) == status::success,
-            VERBOSE_UNSUPPORTED_POSTOP);
-    VDISPATCH_GNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+        io_.init_bf16();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
 
-    nthr_ = dnnl_get_max_threads();
-    auto scratchpad = scratchpad_registry().registrar();
-    if (!stats_is_src()) {
-        using namespace memory_tracking::names;
-        // C() is used here for convenience, to let C++ reduce over the group.
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_diff_dst_start, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
+        mov(reg_diff_scale, ptr[reg_param + PARAM_OFF(diff_scale)]);
+        mov(reg_diff_shift, ptr[reg_param + PARAM_OFF(diff_shift)]);
+#undef PARAM_OFF
+
+        if (nc_blocks_) {
+            xor_(reg_nc_block, reg_nc_block);
+            Xbyak::Label c_blk_loop, c_blk_loop_end;
+            L(c_blk_loop);
+            {
+                cmp(reg_nc_block, nc_blocks_);
+                je(c_blk_loop_end, T_NEAR);
+
+                compute_diff_ss_block(unroll_c_);
+                advance_channels(c_block_);
+                add(reg_nc_block, 1);
+
+                jmp(c_blk_loop);
+            }
+            L(c_blk_loop_end);
+        }
+
+        if (unroll_c_tail_) {
+            compute_diff_ss_block(unroll_c_tail_);
+            advance_channels(c_block_tail_);
+        }
+
+        if (axis_simd_tail_) compute_diff_ss_block(1, true);
+
+        postamble();
+    }
+
+    void operator()(const void *src, const void *diff_dst, const float *mean,
+            const float *inv_sqrtvar, float *diff_scale, float *diff_shift,
+            size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.diff_dst = diff_dst;
+        args.mean = mean;
+        args.inv_sqrtvar = inv_sqrtvar;
+        args.diff_scale = diff_scale;
+        args.diff_shift = diff_shift;
+        args.block_size = block_size;
+
+        jit_generator_t::operator()(&args);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
+            : (isa == avx2)                             ? yword
+                                                        : zword;
+    const int vlen = cpu_isa_traits_t<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        const float *mean;
+        const float *inv_sqrtvar;
+        float *diff_scale;
+        float *diff_shift;
+        size_t block_size;
+    };
+
+    const memory_desc_wrapper src_d_, diff_dst_d_;
+    const dim_t C_block_;
+    const size_t simd_w_;
+    const dim_t axis_simd_tail_;
+    // Six registers are used per unrolled vector, avx2 has only 16 of them.
+    static constexpr dim_t unroll_c_ = isa == avx2 ? 2 : 4;
+    const dim_t c_block_;
+    const dim_t nc_blocks_;
+    const dim_t c_block_tail_;
+    const dim_t unroll_c_tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    void advance_channels(dim_t nchannels) {
+        add(reg_src_start, nchannels * src_d_.data_type_size());
+        add(reg_diff_dst_start, nchannels * diff_dst_d_.data_type_size());
+        add(reg_mean, nchannels * sizeof(float));
+        add(reg_inv_sqrtvar, nchannels * sizeof(float));
+        add(reg_diff_scale, nchannels * sizeof(float));
+        add(reg_diff_shift, nchannels * sizeof(float));
+    }
+
+    void compute_diff_ss_block(size_t unroll, bool tail = false) {
+        for (size_t ur = 0; ur < unroll; ur++) {
+            // Masked loads zero the tail lanes, so they don't contribute to
+            // accumulators.
+            io_[f32]->load(mean_ptr(ur * simd_w_), Vmm_mean(ur), tail);
+            io_[f32]->load(
+                    inv_sqrtvar_ptr(ur * simd_w_), Vmm_inv_sqrtvar(ur), tail);
+            uni_vpxor(Vmm_diff_scale(ur), Vmm_diff_scale(ur),
+                    Vmm_diff_scale(ur));
+            uni_vpxor(Vmm_diff_shift(ur), Vmm_diff_shift(ur),
+                    Vmm_diff_shift(ur));
+        }
+
+        mov(reg_src, reg_src_start);
+        mov(reg_diff_dst, reg_diff_dst_start);
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_rows, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+
+        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
+        L(sp_blk_loop);
+        {
+            cmp(reg_rows, 0);
+            jle(sp_blk_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[src_d_.data_type()]->load(
+                        src_ptr(ur * simd_w_), Vmm_src(ur), tail);
+                io_[diff_dst_d_.data_type()]->load(
+                        diff_dst_ptr(ur * simd_w_), Vmm_diff_dst(ur), tail);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_mean(ur));
+                uni_vmulps(Vmm_src(ur), Vmm_src(ur), Vmm_inv_sqrtvar(ur));
+                uni_vfmadd231ps(
+                        Vmm_diff_scale(ur), Vmm_src(ur), Vmm_diff_dst(ur));
+                uni_vaddps(
+                        Vmm_diff_shift(ur), Vmm_diff_shift(ur), Vmm_diff_dst(ur));
+            }
+
+            add(reg_src, C_block_ * src_d_.data_type_size());
+            add(reg_diff_dst, C_block_ * diff_dst_d_.data_type_size());
+            sub(reg_rows, 1);
+            jmp(sp_blk_loop);
+        }
+        L(sp_blk_loop_end);
+
+        // Accumulate into the output as the driver calls the kernel for
+        // several spatial chunks and minibatches.
+        for (size_t ur = 0; ur < unroll; ur++) {
+            io_[f32]->load(diff_scale_ptr(ur * simd_w_), Vmm_src(ur), tail);
+            uni_vaddps(Vmm_diff_scale(ur), Vmm_diff_scale(ur), Vmm_src(ur));
+            io_[f32]->store(
+                    Vmm_diff_scale(ur), diff_scale_ptr(ur * simd_w_), tail);
+            io_[f32]->load(diff_shift_ptr(ur * simd_w_), Vmm_src(ur), tail);
+            uni_vaddps(Vmm_diff_shift(ur), Vmm_diff_shift(ur), Vmm_src(ur));
+            io_[f32]->store(
+                    Vmm_diff_shift(ur), diff_shift_ptr(ur * simd_w_), tail);
+        }
+    }
+
+    Vmm Vmm_mean(size_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
+    Vmm Vmm_inv_sqrtvar(size_t ur = 0) { return Vmm(1 + 1 * unroll_c_ + ur); }
+    Vmm Vmm_diff_scale(size_t ur = 0) { return Vmm(1 + 2 * unroll_c_ + ur); }
+    Vmm Vmm_diff_shift(size_t ur = 0) { return Vmm(1 + 3 * unroll_c_ + ur); }
+    Vmm Vmm_src(size_t ur = 0) { return Vmm(1 + 4 * unroll_c_ + ur); }
+    Vmm Vmm_diff_dst(size_t ur = 0) { return Vmm(1 + 5 * unroll_c_ + ur); }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src + offt * src_d_.data_type_size()];
+    }
+
+    Xbyak::Address diff_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_dst + offt * diff_dst_d_.data_type_size()];
+    }
+
+    Xbyak::Address mean_ptr(size_t offt = 0) {
+        return vmmword[reg_mean + offt * sizeof(float)];
+    }
+
+    Xbyak::Address inv_sqrtvar_ptr(size_t offt = 0) {
+        return vmmword[reg_inv_sqrtvar + offt * sizeof(float)];
+    }
+
+    Xbyak::Address diff_scale_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_scale + offt * sizeof(float)];
+    }
+
+    Xbyak::Address diff_shift_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_shift + offt * sizeof(float)];
+    }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = rdx;
+    const Xbyak::Reg64 reg_diff_dst = rax;
+    const Xbyak::Reg64 reg_mean = rbx;
+    const Xbyak::Reg64 reg_inv_sqrtvar = r8;
+    const Xbyak::Reg64 reg_rows = r9;
+    const Xbyak::Reg64 reg_nc_block = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_diff_scale = r12;
+    const Xbyak::Reg64 reg_diff_shift = r13;
+    const Xbyak::Reg64 reg_src_start = r14;
+    const Xbyak::Reg64 reg_diff_dst_start = r15;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct diff_ss_kernel_t<avx2>;
+template struct diff_ss_kernel_t<avx512_core>;
+
+template <cpu_isa_t isa>
+struct diff_data_kernel_t
+    : public jit_uni_group_normalization_bwd_t::diff_data_kernel_base_t,
+      public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_uni_group_normalization_bwd_t::diff_data_kernel_t);
+
+    diff_data_kernel_t(const jit_uni_group_normalization_bwd_t::pd_t *pd)
+        : jit_generator_t(jit_name(), isa)
+        , src_d_(pd->src_md())
+        , diff_dst_d_(pd->diff_dst_md())
+        , diff_src_d_(pd->diff_src_md())
+        , C_block_(pd->c_block())
+        , simd_w_(vlen / sizeof(float))
+        , axis_simd_tail_(C_block_ % simd_w_)
+        , c_block_(unroll_c_ * simd_w_)
+        , nc_blocks_(C_block_ / c_block_)
+        , c_block_tail_((C_block_ % c_block_) - axis_simd_tail_)
+        , unroll_c_tail_(c_block_tail_ / simd_w_)
+        , calculate_diff_stats_(!pd->stats_is_src()) {
+
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa,
+                utils::one_of(f16, src_d_.data_type(), diff_dst_d_.data_type(),
+                        diff_src_d_.data_type()),
+                utils::one_of(bf16, src_d_.data_type(), diff_dst_d_.data_type(),
+                        diff_src_d_.data_type()));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_d_.data_type(), diff_dst_d_.data_type(),
+                        diff_src_d_.data_type(), f32 /* stats */},
+                io_conf, io_tail_conf, io_bf16_conf);
+
+        VDEBUGINFO(1, primitive, group_normalization,
+                "%s:\n    C_block_=%" PRId64
+                "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
+                "\n    unroll_c_=%" PRId64 "\n    nc_blocks_=%" PRId64
+                "\n    unroll_c_tail_=%" PRId64
+                "\n    calculate_diff_stats_=%d",
+                jit_name(), C_block_, simd_w_, axis_simd_tail_, unroll_c_,
+                nc_blocks_, unroll_c_tail_, calculate_diff_stats_);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_diff_dst_start, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_diff_src_start, ptr[reg_param + PARAM_OFF(diff_src)]);
+        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        mov(reg_coeff_a, ptr[reg_param + PARAM_OFF(coeff_a)]);
+        mov(reg_coeff_b, ptr[reg_param + PARAM_OFF(coeff_b)]);
+        mov(reg_coeff_c, ptr[reg_param + PARAM_OFF(coeff_c)]);
+#undef PARAM_OFF
+
+        if (nc_blocks_) {
+            xor_(reg_nc_block, reg_nc_block);
+            Xbyak::Label c_blk_loop, c_blk_loop_end;
+            L(c_blk_loop);
+            {
+                cmp(reg_nc_block, nc_blocks_);
+                je(c_blk_loop_end, T_NEAR);
+
+                compute_diff_src_block(unroll_c_);
+                advance_channels(c_block_);
+                add(reg_nc_block, 1);
+
+                jmp(c_blk_loop);
+            }
+            L(c_blk_loop_end);
+        }
+
+        if (unroll_c_tail_) {
+            compute_diff_src_block(unroll_c_tail_);
+            advance_channels(c_block_tail_);
+        }
+
+        if (axis_simd_tail_) compute_diff_src_block(1, true);
+
+        postamble();
+    }
+
+    void operator()(const void *src, const void *diff_dst, void *diff_src,
+            const float *mean, const float *coeff_a, const float *coeff_b,
+            const float *coeff_c, size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.diff_dst = diff_dst;
+        args.diff_src = diff_src;
+        args.mean = mean;
+        args.coeff_a = coeff_a;
+        args.coeff_b = coeff_b;
+        args.coeff_c = coeff_c;
+        args.block_size = block_size;
+
+        jit_generator_t::operator()(&args);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
+            : (isa == avx2)                             ? yword
+                                                        : zword;
+    const int vlen = cpu_isa_traits_t<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        void *diff_src;
+        const float *mean;
+        const float *coeff_a;
+        const float *coeff_b;
+        const float *coeff_c;
+        size_t block_size;
+    };
+
+    const memory_desc_wrapper src_d_, diff_dst_d_, diff_src_d_;
+    const dim_t C_block_;
+    const size_t simd_w_;
+    const dim_t axis_simd_tail_;
+    // Six registers are used per unrolled vector, avx2 has only 16 of them.
+    static constexpr dim_t unroll_c_ = isa == avx2 ? 2 : 4;
+    const dim_t c_block_;
+    const dim_t nc_blocks_;
+    const dim_t c_block_tail_;
+    const dim_t unroll_c_tail_;
+    const bool calculate_diff_stats_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    void advance_channels(dim_t nchannels) {
+        add(reg_src_start, nchannels * src_d_.data_type_size());
+        add(reg_diff_dst_start, nchannels * diff_dst_d_.data_type_size());
+        add(reg_diff_src_start, nchannels * diff_src_d_.data_type_size());
+        add(reg_mean, nchannels * sizeof(float));
+        add(reg_coeff_a, nchannels * sizeof(float));
+        add(reg_coeff_b, nchannels * sizeof(float));
+        add(reg_coeff_c, nchannels * sizeof(float));
+    }
+
+    void compute_diff_src_block(size_t unroll, bool tail = false) {
+        for (size_t ur = 0; ur < unroll; ur++) {
+            io_[f32]->load(coeff_a_ptr(ur * simd_w_), Vmm_coeff_a(ur), tail);
+            if (calculate_diff_stats_) {
+                io_[f32]->load(mean_ptr(ur * simd_w_), Vmm_mean(ur), tail);
+                io_[f32]->load(
+                        coeff_b_ptr(ur * simd_w_), Vmm_coeff_b(ur), tail);
+                io_[f32]->load(
+                        coeff_c_ptr(ur * simd_w_), Vmm_coeff_c(ur), tail);
+            }
+        }
+
+        mov(reg_src, reg_src_start);
+        mov(reg_diff_dst, reg_diff_dst_start);
+        mov(reg_diff_src, reg_diff_src_start);
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_rows, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+
+        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
+        L(sp_blk_loop);
+        {
+            cmp(reg_rows, 0);
+            jle(sp_blk_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[diff_dst_d_.data_type()]->load(
+                        diff_dst_ptr(ur * simd_w_), Vmm_diff_dst(ur), tail);
+                if (calculate_diff_stats_)
+                    io_[src_d_.data_type()]->load(
+                            src_ptr(ur * simd_w_), Vmm_src(ur), tail);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                if (calculate_diff_stats_) {
+                    uni_vsubps(Vmm_src(ur), Vmm_src(ur), Vmm_mean(ur));
+                    uni_vsubps(
+                            Vmm_diff_dst(ur), Vmm_diff_dst(ur), Vmm_coeff_c(ur));
+                    uni_vfnmadd231ps(
+                            Vmm_diff_dst(ur), Vmm_src(ur), Vmm_coeff_b(ur));
+                }
+                uni_vmulps(Vmm_diff_dst(ur), Vmm_diff_dst(ur), Vmm_coeff_a(ur));
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[diff_src_d_.data_type()]->store(
+                        Vmm_diff_dst(ur), diff_src_ptr(ur * simd_w_), tail);
+            }
+
+            add(reg_src, C_block_ * src_d_.data_type_size());
+            add(reg_diff_dst, C_block_ * diff_dst_d_.data_type_size());
+            add(reg_diff_src, C_block_ * diff_src_d_.data_type_size());
+            sub(reg_rows, 1);
+            jmp(sp_blk_loop);
+        }
+        L(sp_blk_loop_end);
+    }
+
+    Vmm Vmm_mean(size_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
+    Vmm Vmm_coeff_a(size_t ur = 0) { return Vmm(1 + 1 * unroll_c_ + ur); }
+    Vmm Vmm_coeff_b(size_t ur = 0) { return Vmm(1 + 2 * unroll_c_ + ur); }
+    Vmm Vmm_coeff_c(size_t ur = 0) { return Vmm(1 + 3 * unroll_c_ + ur); }
+    Vmm Vmm_src(size_t ur = 0) { return Vmm(1 + 4 * unroll_c_ + ur); }
+    Vmm Vmm_diff_dst(size_t ur = 0) { return Vmm(1 + 5 * unroll_c_ + ur); }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src + offt * src_d_.data_type_size()];
+    }
+
+    Xbyak::Address diff_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_dst + offt * diff_dst_d_.data_type_size()];
+    }
+
+    Xbyak::Address diff_src_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_src + offt * diff_src_d_.data_type_size()];
+    }
+
+    Xbyak::Address mean_ptr(size_t offt = 0) {
+        return vmmword[reg_mean + offt * sizeof(float)];
+    }
+
+    Xbyak::Address coeff_a_ptr(size_t offt = 0) {
+        return vmmword[reg_coeff_a + offt * sizeof(float)];
+    }
+
+    Xbyak::Address coeff_b_ptr(size_t offt = 0) {
+        return vmmword[reg_coeff_b + offt * sizeof(float)];
+    }
+
+    Xbyak::Address coeff_c_ptr(size_t offt = 0) {
+        return vmmword[reg_coeff_c + offt * sizeof(float)];
+    }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = rdx;
+    const Xbyak::Reg64 reg_diff_dst = rax;
+    const Xbyak::Reg64 reg_mean = rbx;
+    const Xbyak::Reg64 reg_coeff_a = r8;
+    const Xbyak::Reg64 reg_rows = r9;
+    const Xbyak::Reg64 reg_nc_block = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_coeff_b = r12;
+    const Xbyak::Reg64 reg_coeff_c = r13;
+    const Xbyak::Reg64 reg_src_start = r14;
+    const Xbyak::Reg64 reg_diff_dst_start = r15;
+    const Xbyak::Reg64 reg_diff_src = rsi;
+    const Xbyak::Reg64 reg_diff_src_start = rbp;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct diff_data_kernel_t<avx2>;
+template struct diff_data_kernel_t<avx512_core>;
+
+} // namespace
+
+jit_uni_group_normalization_fwd_t::kernel_base_t *
+jit_uni_group_normalization_fwd_t::kernel_base_t::create(const pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new kernel_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new kernel_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
+jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(
+        const pd_t *apd, bool compute_var) {
+    if (mayiuse(avx512_core)) {
+        return new kernel_stat_t<avx512_core>(apd, compute_var);
+    } else if (mayiuse(avx2)) {
+        return new kernel_stat_t<avx2>(apd, compute_var);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper src_d(src_md());
+
+    VDISPATCH_GNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(IMPLICATION(utils::one_of(bf16, src_md()->data_type,
+                                        dst_md()->data_type),
+                            mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(IMPLICATION(utils::one_of(f16, src_md()->data_type,
+                                        dst_md()->data_type),
+                            mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(attr()->has_default_values(
+                            skip_mask_t::scales | skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GNORM(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GNORM(
+            memory_desc_matches_one_of_tag(*src_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_GNORM(
+            memory_desc_matches_one_of_tag(*dst_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VDISPATCH_GNORM(impl::is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    // A group that doesn't fill a vector register, instance normalization in
+    // particular, is processed as full rows of channels with per-channel
+    // statistics which are reduced over groups afterwards.
+    // There's also some dispatching logic in parallelization to process groups
+    // differently, see the comment in a correspondent section.
+    const dim_t C_PER_G = C() / G();
+    const dim_t simd_w = isa_max_vlen(get_supported_isa()) / sizeof(float);
+    per_channel_ = C_PER_G < simd_w;
+
+    auto post_ops_ok = [&]() -> bool {
+        const std::vector<injector::post_op_type> accepted_post_ops
+                = {injector::eltwise, injector::binary, injector::sum};
+        const memory_desc_wrapper dst_d(dst_md());
+        injector::post_ops_ok_args_t post_ops_args(get_supported_isa(),
+                accepted_post_ops, attr()->post_ops_, &dst_d, true, true, true,
+                true, get_supported_bcast_strategies(per_channel_));
+
+        return injector::post_ops_ok(post_ops_args);
+    };
+    VDISPATCH_GNORM(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_GNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    nthr_ = dnnl_get_max_threads();
+
+    // A second pass over the source is cheap when it hits the data a thread
+    // has just read. Otherwise, a single sweep halves the memory traffic spent
+    // on statistics. A thread reads a whole group between passes when groups
+    // are processed by single threads, and its share of the source otherwise.
+    // Check for `SINGLE_KERNEL_HEURISTIC_ANCHOR` for a pairing spot.
+    const dim_t SP = D() * H() * W();
+    const size_t dt_size = types::data_type_size(src_md()->data_type);
+    const size_t bytes_between_passes = !per_channel_ && C_PER_G >= 32
+            ? SP * C_PER_G * dt_size
+            : MB() * SP * C() * dt_size / nthr_;
+    single_pass_stats_ = !stats_is_src()
+            && bytes_between_passes > platform::get_per_core_cache_size(2);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    using namespace memory_tracking::names;
+    if (!stats_is_src()) {
+        // C() is used here for convenience, to let C++ reduce over the group.
         // TODO: replace with G() instead and make reduction in registers.
         const size_t stats_size = MB() * C();
-        const size_t stats_reduction_buf_sz = stats_size * nthr_;
+        // Single pass keeps shifted sums of values and squares, and pivots.
+        const size_t stats_reduction_buf_sz
+                = stats_size * nthr_ * (single_pass_stats_ ? 3 : 1);
         scratchpad.template book<float>(
                 key_gnorm_reduction, stats_reduction_buf_sz);
         if (!is_training()) {
@@ -860,10 +1571,37 @@ status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
             scratchpad.template book<float>(key_gnorm_tmp_var, stats_size);
         }
     }
+    // Group mean and variance broadcast over channels.
+    if (per_channel_)
+        scratchpad.template book<float>(key_gnorm_coeffs, 2 * MB() * C());
 
     return status::success;
 }
 
+namespace {
+// Combines single pass partial statistics, each being `cnt` values with sums
+// of `value - pivot` and of its squares, into a mean and a variance.
+struct shifted_stats_t {
+    void add(dim_t cnt, float sum, float sum_sq, float pivot) {
+        if (cnt == 0) return;
+        const float part_mean = sum / cnt;
+        const float part_m2 = sum_sq - sum * part_mean;
+        const float delta = pivot + part_mean - mean_;
+        const dim_t new_cnt = cnt_ + cnt;
+        mean_ += delta * cnt / new_cnt;
+        m2_ += part_m2 + delta * delta * cnt_ * cnt / new_cnt;
+        cnt_ = new_cnt;
+    }
+    float mean() const { return mean_; }
+    float var() const { return cnt_ ? m2_ / cnt_ : 0.f; }
+
+private:
+    dim_t cnt_ = 0;
+    float mean_ = 0.f;
+    float m2_ = 0.f;
+};
+} // namespace
+
 status_t jit_uni_group_normalization_fwd_t::execute_forward(
         const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
@@ -910,8 +1648,129 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     const dim_t SP = D * H * W;
 
     const bool calculate_stats = !pd()->stats_is_src();
+    const bool single_pass = pd()->single_pass_stats_;
     const int nthr = pd()->nthr_;
 
+    // Single pass partial statistics: shifted sums go to the `mean` and `var`
+    // slots and pivots to the third one.
+    const size_t stat_buf_sz = (size_t)N * C * nthr;
+    float *stat_sum = stat_reduction;
+    float *stat_sum_sq = stat_reduction + stat_buf_sz;
+    float *stat_pivot = stat_reduction + 2 * stat_buf_sz;
+
+    if (pd()->per_channel_) {
+        // Spatial is split into `nthr` chunks, each processed for every
+        // minibatch and keeping per-channel partial stats which are reduced
+        // over the group and chunks afterwards. Chunks are distributed with
+        // `parallel_nd` so that all partial stats are written even when fewer
+        // threads are available at execution.
+        auto src_at = [&](dim_t n, dim_t sp) {
+            const size_t off = (size_t)n * SP * C_padded + sp * C_padded;
+            return static_cast<const char *>(src)
+                    + off * src_d.data_type_size();
+        };
+        auto part_off = [&](dim_t n, dim_t ithr) {
+            return ((size_t)n * nthr + ithr) * C;
+        };
+
+        float *mean_c = scratchpad.template get<float>(key_gnorm_coeffs);
+        float *var_c = mean_c + N * C;
+
+        auto expand = [&](float *stat_c, const float *stat) {
+            parallel_nd(N, C, [&](dim_t n, dim_t c) {
+                stat_c[n * C + c] = stat[n * G + c / C_PER_G];
+            });
+        };
+
+        auto reduce = [&](float *stat, const float *tmp_stat) {
+            parallel_nd(N, G, [&](dim_t n, dim_t g) {
+                float s = 0.f;
+                for (int ithr = 0; ithr < nthr; ithr++) {
+                    dim_t SP_start = 0, SP_end = 0;
+                    balance211(SP, nthr, ithr, SP_start, SP_end);
+                    if (SP_start == SP_end) continue;
+                    const float *loc_stat
+                            = tmp_stat + part_off(n, ithr) + g * C_PER_G;
+                    for (dim_t c = 0; c < C_PER_G; c++)
+                        s += loc_stat[c];
+                }
+                stat[n * G + g] = s / (C_PER_G * SP);
+            });
+        };
+
+        if (calculate_stats && single_pass) {
+            parallel_nd(nthr, [&](dim_t ithr) {
+                dim_t SP_start = 0, SP_end = 0;
+                balance211(SP, nthr, static_cast<int>(ithr), SP_start, SP_end);
+                if (SP_start == SP_end) return;
+                for (dim_t n = 0; n < N; ++n) {
+                    const size_t off = part_off(n, ithr);
+                    (*kernel_mean_)(src_at(n, SP_start), stat_sum + off,
+                            stat_sum_sq + off, stat_pivot + off,
+                            SP_end - SP_start);
+                }
+            });
+            parallel_nd(N, G, [&](dim_t n, dim_t g) {
+                shifted_stats_t stats;
+                for (int ithr = 0; ithr < nthr; ithr++) {
+                    dim_t SP_start = 0, SP_end = 0;
+                    balance211(SP, nthr, ithr, SP_start, SP_end);
+                    for (dim_t c = 0; c < C_PER_G; c++) {
+                        const size_t off = part_off(n, ithr) + g * C_PER_G + c;
+                        stats.add(SP_end - SP_start, stat_sum[off],
+                                stat_sum_sq[off], stat_pivot[off]);
+                    }
+                }
+                mean[n * G + g] = stats.mean();
+                variance[n * G + g] = stats.var();
+            });
+        } else if (calculate_stats) {
+            // compute mean
+            parallel_nd(nthr, [&](dim_t ithr) {
+                dim_t SP_start = 0, SP_end = 0;
+                balance211(SP, nthr, static_cast<int>(ithr), SP_start, SP_end);
+                if (SP_start == SP_end) return;
+                for (dim_t n = 0; n < N; ++n) {
+                    (*kernel_mean_)(src_at(n, SP_start),
+                            stat_reduction + part_off(n, ithr),
+                            SP_end - SP_start);
+                }
+            });
+            reduce(mean, stat_reduction);
+            expand(mean_c, mean);
+            // compute variance
+            parallel_nd(nthr, [&](dim_t ithr) {
+                dim_t SP_start = 0, SP_end = 0;
+                balance211(SP, nthr, static_cast<int>(ithr), SP_start, SP_end);
+                if (SP_start == SP_end) return;
+                for (dim_t n = 0; n < N; ++n) {
+                    (*kernel_var_)(src_at(n, SP_start), mean_c + n * C,
+                            stat_reduction + part_off(n, ithr),
+                            SP_end - SP_start);
+                }
+            });
+            reduce(variance, stat_reduction);
+        }
+        expand(mean_c, mean);
+        expand(var_c, variance);
+
+        parallel_nd(nthr, [&](dim_t ithr) {
+            dim_t SP_start = 0, SP_end = 0;
+            balance211(SP, nthr, static_cast<int>(ithr), SP_start, SP_end);
+            if (SP_start == SP_end) return;
+            for (dim_t n = 0; n < N; ++n) {
+                const size_t data_off = n * SP * C_padded + SP_start * C_padded;
+                char *const __restrict dst_ptr = static_cast<char *>(dst)
+                        + data_off * dst_d.data_type_size();
+                (*kernel_)(src_at(n, SP_start), dst_ptr, scale, shift,
+                        mean_c + n * C, var_c + n * C, src_scales, dst_scales,
+                        post_ops_binary_rhs_arg_vec.data(), SP_end - SP_start);
+            }
+        });
+
+        return status::success;
+    }
+
     // There are two algorithms to distribute the problem among threads:
     // * Single-threaded-group - it gives each thread a whole group and runs
     //   it through all kernels. In this case there are no dependencies and
@@ -947,7 +1806,11 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                 float *mean_ptr = mean + i;
                 float *var_ptr = variance + i;
 
-                if (calculate_stats) {
+                if (calculate_stats && single_pass) {
+                    // The kernel processes a whole group and stores final
+                    // stats, no pivot is needed.
+                    (*kernel_mean_)(src_ptr, mean_ptr, var_ptr, nullptr, SP);
+                } else if (calculate_stats) {
                     (*kernel_mean_)(src_ptr, mean_ptr, SP);
                     (*kernel_var_)(src_ptr, mean_ptr, var_ptr, SP);
                 }
@@ -1002,9 +1865,32 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                             = (((i % g_per_n) / G) == nthr_per_g - 1)
                             ? SP_tail_chunk
                             : SP_chunk;
-                    (*kernel_mean_)(src_ptr, mean_ptr, kernel_sp_block_size);
+                    if (single_pass)
+                        (*kernel_mean_)(src_ptr, stat_sum + i, stat_sum_sq + i,
+                                stat_pivot + i, kernel_sp_block_size);
+                    else
+                        (*kernel_mean_)(
+                                src_ptr, mean_ptr, kernel_sp_block_size);
                 }
             });
+        }
+
+        if (calculate_stats && single_pass) {
+            const dim_t SP_chunk = SP / nthr_per_g;
+            parallel_nd(N, G, [&](dim_t n, dim_t g) {
+                shifted_stats_t stats;
+                for (dim_t ithr = 0; ithr < nthr_per_g; ithr++) {
+                    const dim_t i = n * nthr_per_g * G + ithr * G + g;
+                    const dim_t sp_block_size = ithr == nthr_per_g - 1
+                            ? SP - ithr * SP_chunk
+                            : SP_chunk;
+                    stats.add(sp_block_size * C_PER_G, stat_sum[i],
+                            stat_sum_sq[i], stat_pivot[i]);
+                }
+                mean[n * G + g] = stats.mean();
+                variance[n * G + g] = stats.var();
+            });
+        } else if (calculate_stats) {
             reduce(mean, stat_reduction);
 
             parallel(nthr, [&](const int ithr, const int nthr) {
@@ -1085,6 +1971,238 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     return status::success;
 }
 
+jit_uni_group_normalization_bwd_t::diff_ss_kernel_base_t *
+jit_uni_group_normalization_bwd_t::diff_ss_kernel_base_t::create(
+        const pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new diff_ss_kernel_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new diff_ss_kernel_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+jit_uni_group_normalization_bwd_t::diff_data_kernel_base_t *
+jit_uni_group_normalization_bwd_t::diff_data_kernel_base_t::create(
+        const pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new diff_data_kernel_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new diff_data_kernel_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+status_t jit_uni_group_normalization_bwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    VDISPATCH_GNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(diff_dst_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(diff_src_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(IMPLICATION(utils::one_of(bf16, src_md()->data_type,
+                                        diff_dst_md()->data_type,
+                                        diff_src_md()->data_type),
+                            mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(IMPLICATION(utils::one_of(f16, src_md()->data_type,
+                                        diff_dst_md()->data_type,
+                                        diff_src_md()->data_type),
+                            mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GNORM(impl::is_dense_format_kind(
+                            {src_md(), diff_dst_md(), diff_src_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    // Blocked formats are supported when the block matches the vector length
+    // so that a single row of a block is a single register.
+    const bool is_avx512 = mayiuse(avx512_core);
+    const auto tag = is_avx512
+            ? memory_desc_matches_one_of_tag(*src_md(), ndhwc, nhwc, nwc, nc,
+                    nCdhw16c, nChw16c, nCw16c)
+            : memory_desc_matches_one_of_tag(*src_md(), ndhwc, nhwc, nwc, nc,
+                    nCdhw8c, nChw8c, nCw8c);
+    VDISPATCH_GNORM(tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_GNORM(memory_desc_matches_tag(*diff_dst_md(), tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+    VDISPATCH_GNORM(memory_desc_matches_tag(*diff_src_md(), tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_src");
+
+    c_block_ = get_bwd_c_block(memory_desc_wrapper(src_md()));
+    // Padded channels would mix into the per-channel reductions.
+    VDISPATCH_GNORM(C() % c_block_ == 0, VERBOSE_UNSUPPORTED_TAG_S, "src");
+
+    nthr_ = dnnl_get_max_threads();
+    auto scratchpad = scratchpad_registry().registrar();
+    using namespace memory_tracking::names;
+    // Per minibatch and channel mean and coefficients for `diff_data` kernel.
+    scratchpad.template book<float>(key_gnorm_coeffs, 4 * MB() * C());
+    // Per thread diff scale and shift, plus a slot for the reduced values.
+    if (need_diff_ss())
+        scratchpad.template book<float>(
+                key_gnorm_tmp_diff_ss, 2 * C() * (nthr_ + 1));
+
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_bwd_t::execute_backward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    const auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    const auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    const auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
+    auto diff_scale = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SCALE);
+    auto diff_shift = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SHIFT);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const float CSP = static_cast<float>(C_PER_G * SP);
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_diff_stats = !pd()->stats_is_src();
+
+    const dim_t C_block = pd()->c_block();
+    const dim_t nCB = C / C_block;
+    const int nthr = pd()->nthr_;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *coeffs = scratchpad.template get<float>(key_gnorm_coeffs);
+    float *mean_c = coeffs;
+    float *coeff_a = coeffs + 1 * N * C;
+    float *coeff_b = coeffs + 2 * N * C;
+    float *coeff_c = coeffs + 3 * N * C;
+
+    // Group statistics are broadcast over channels, so kernels process any
+    // number of channels per group, including one, the same way.
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        const dim_t stat_off = n * G + c / C_PER_G;
+        mean_c[n * C + c] = mean[stat_off];
+        coeff_a[n * C + c] = 1.f / sqrtf(variance[stat_off] + eps);
+    });
+
+    // Work is distributed over minibatch, channel blocks and spatial chunks.
+    // Spatial is split only when there's not enough work otherwise.
+    const dim_t nSP
+            = std::min(SP, utils::div_up(static_cast<dim_t>(nthr), N * nCB));
+    const dim_t SP_chunk = utils::div_up(SP, nSP);
+    const dim_t work_amount = N * nCB * nSP;
+
+    auto data_off = [&](dim_t n, dim_t cb, dim_t sp) {
+        return (n * C * SP + cb * SP * C_block + sp * C_block);
+    };
+
+    if (pd()->need_diff_ss()) {
+        float *tmp_diff_ss
+                = scratchpad.template get<float>(key_gnorm_tmp_diff_ss);
+        // Kernels accumulate into per-thread buffers. All of them are zeroed
+        // as the runtime may spawn fewer threads than requested.
+        utils::array_set(tmp_diff_ss, 0.f, 2 * C * nthr);
+
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            float *ithr_diff_scale = tmp_diff_ss + 2 * C * ithr;
+            float *ithr_diff_shift = ithr_diff_scale + C;
+
+            dim_t start = 0, end = 0;
+            balance211(work_amount, nthr, ithr, start, end);
+
+            dim_t n {0}, cb {0}, isp {0};
+            utils::nd_iterator_init(start, n, N, cb, nCB, isp, nSP);
+            for (dim_t iwork = start; iwork < end; iwork++) {
+                const dim_t sp_start = isp * SP_chunk;
+                const dim_t sp_size = std::min(SP_chunk, SP - sp_start);
+                if (sp_size > 0) {
+                    const size_t off = data_off(n, cb, sp_start);
+                    const dim_t c_off = cb * C_block;
+                    (*diff_ss_kernel_)(static_cast<const char *>(src)
+                                    + off * src_d.data_type_size(),
+                            static_cast<const char *>(diff_dst)
+                                    + off * diff_dst_d.data_type_size(),
+                            mean_c + n * C + c_off, coeff_a + n * C + c_off,
+                            ithr_diff_scale + c_off, ithr_diff_shift + c_off,
+                            sp_size);
+                }
+                utils::nd_iterator_step(n, N, cb, nCB, isp, nSP);
+            }
+        });
+
+        float *red_diff_scale = tmp_diff_ss + 2 * C * nthr;
+        float *red_diff_shift = red_diff_scale + C;
+        parallel_nd(C, [&](dim_t c) {
+            float diff_gamma = 0.f, diff_beta = 0.f;
+            for (int ithr = 0; ithr < nthr; ithr++) {
+                diff_gamma += tmp_diff_ss[2 * C * ithr + c];
+                diff_beta += tmp_diff_ss[2 * C * ithr + C + c];
+            }
+            red_diff_scale[c] = diff_gamma;
+            red_diff_shift[c] = diff_beta;
+            if (diff_scale) diff_scale[c] = diff_gamma;
+            if (diff_shift) diff_shift[c] = diff_beta;
+        });
+
+        if (calculate_diff_stats) {
+            parallel_nd(N, C, [&](dim_t n, dim_t c) {
+                const float inv_sqrtvar = coeff_a[n * C + c];
+                coeff_b[n * C + c] = red_diff_scale[c] * inv_sqrtvar / CSP;
+                coeff_c[n * C + c] = red_diff_shift[c] / CSP;
+            });
+        }
+    }
+
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        coeff_a[n * C + c] *= scale ? scale[c] : 1.f;
+    });
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        dim_t n {0}, cb {0}, isp {0};
+        utils::nd_iterator_init(start, n, N, cb, nCB, isp, nSP);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t sp_start = isp * SP_chunk;
+            const dim_t sp_size = std::min(SP_chunk, SP - sp_start);
+            if (sp_size > 0) {
+                const size_t off = data_off(n, cb, sp_start);
+                const dim_t nc_off = n * C + cb * C_block;
+                (*diff_data_kernel_)(static_cast<const char *>(src)
+                                + off * src_d.data_type_size(),
+                        static_cast<const char *>(diff_dst)
+                                + off * diff_dst_d.data_type_size(),
+                        static_cast<char *>(diff_src)
+                                + off * diff_src_d.data_type_size(),
+                        mean_c + nc_off, coeff_a + nc_off, coeff_b + nc_off,
+                        coeff_c + nc_off, sp_size);
+            }
+            utils::nd_iterator_step(n, N, cb, nCB, isp, nSP);
+        }
+    });
+
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
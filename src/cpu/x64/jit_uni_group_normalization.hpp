@@ -40,13 +40,22 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
         status_t init(engine_t *engine);
 
         int nthr_; // To not exceed the limit in execute used for set up.
+        // Kernels process full rows of channels with per-channel statistics
+        // instead of a single group at a time. Used for groups too small to
+        // fill a vector register, including instance normalization.
+        bool per_channel_ = false;
+        // Statistics are computed in a single sweep over the source using
+        // sums shifted by a pivot value instead of separate mean and
+        // variance passes.
+        bool single_pass_stats_ = false;
     };
 
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
         CHECK(safe_ptr_assign(kernel_mean_, kernel_stat_base_t::create(pd())));
-        CHECK(safe_ptr_assign(
-                kernel_var_, kernel_stat_base_t::create(pd(), true)));
+        if (!pd()->single_pass_stats_)
+            CHECK(safe_ptr_assign(
+                    kernel_var_, kernel_stat_base_t::create(pd(), true)));
         if (kernel_) CHECK(kernel_->create_kernel());
         if (kernel_mean_) CHECK(kernel_mean_->create_kernel());
         if (kernel_var_) CHECK(kernel_var_->create_kernel());
@@ -63,16 +72,16 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
                 const float *src_scales, const float *dst_scales,
                 const void *post_ops_binary_rhs_arg_vec,
                 const size_t block_size) const = 0;
-        static kernel_base_t *create(const group_normalization_pd_t *pd);
+        static kernel_base_t *create(const pd_t *pd);
         virtual status_t create_kernel() = 0;
         virtual ~kernel_base_t() = default;
 
     protected:
-        kernel_base_t(const group_normalization_pd_t *pd) : pd_(pd) {}
+        kernel_base_t(const pd_t *pd) : pd_(pd) {}
 
         // `pd_` is needed to access its members (such as `attr()`) in
         // `generate()` call.
-        const group_normalization_pd_t *pd_;
+        const pd_t *pd_;
     };
 
     struct kernel_stat_base_t {
@@ -80,8 +89,13 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
                 const void *src, float *mean, size_t block_size) const = 0;
         virtual void operator()(const void *src, const float *mean, float *var,
                 size_t block_size) const = 0;
+        // Single pass statistics: sums of `src - pivot` and its squares are
+        // stored to `mean` and `var`, and the pivot to `pivot`. When a kernel
+        // processes a whole group, final mean and variance are stored instead.
+        virtual void operator()(const void *src, float *mean, float *var,
+                float *pivot, size_t block_size) const = 0;
         static kernel_stat_base_t *create(
-                const group_normalization_pd_t *pd, bool compute_var = false);
+                const pd_t *pd, bool compute_var = false);
         virtual status_t create_kernel() = 0;
         virtual ~kernel_stat_base_t() = default;
     };
@@ -95,6 +109,79 @@ protected:
     std::unique_ptr<kernel_stat_base_t> kernel_var_;
 };
 
+struct jit_uni_group_normalization_bwd_t : public primitive_t {
+    using primitive_t::primitive_t;
+
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        using cpu_group_normalization_bwd_pd_t::
+                cpu_group_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("jit_group:uni", jit_uni_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Number of channels processed by kernels in a single row: `C` for
+        // channels-last formats, the channel block size for blocked ones.
+        dim_t c_block() const { return c_block_; }
+        // Diff scale and shift are needed either as outputs or as inputs for
+        // diff src computation.
+        bool need_diff_ss() const {
+            return !stats_is_src() || use_scale() || use_shift();
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        dim_t c_block_ = 0;
+    };
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(
+                diff_ss_kernel_, diff_ss_kernel_base_t::create(pd())));
+        CHECK(safe_ptr_assign(
+                diff_data_kernel_, diff_data_kernel_base_t::create(pd())));
+        if (diff_ss_kernel_) CHECK(diff_ss_kernel_->create_kernel());
+        if (diff_data_kernel_) CHECK(diff_data_kernel_->create_kernel());
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+    // Accumulates per-channel diff scale and shift over `block_size` rows of
+    // `C_block` channels. `mean` and `inv_sqrtvar` are per-channel values.
+    struct diff_ss_kernel_base_t {
+        virtual void operator()(const void *src, const void *diff_dst,
+                const float *mean, const float *inv_sqrtvar, float *diff_scale,
+                float *diff_shift, size_t block_size) const = 0;
+        static diff_ss_kernel_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~diff_ss_kernel_base_t() = default;
+    };
+
+    // Computes `diff_src = a * (diff_dst - c - (src - mean) * b)` over
+    // `block_size` rows of `C_block` channels, where `a`, `b` and `c` are
+    // per-channel coefficients prepared by the driver. Only `a` is used with
+    // global stats.
+    struct diff_data_kernel_base_t {
+        virtual void operator()(const void *src, const void *diff_dst,
+                void *diff_src, const float *mean, const float *coeff_a,
+                const float *coeff_b, const float *coeff_c,
+                size_t block_size) const = 0;
+        static diff_data_kernel_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~diff_data_kernel_base_t() = default;
+    };
+
+protected:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<diff_ss_kernel_base_t> diff_ss_kernel_;
+    std::unique_ptr<diff_data_kernel_base_t> diff_data_kernel_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
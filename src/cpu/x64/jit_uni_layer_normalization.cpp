@@ -123,7 +123,13 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(
                           src_d_.data_type(), data_type::f16, data_type::bf16))
-        , skip_mean_(pd_->skip_mean()) {
+        , skip_mean_(pd_->skip_mean())
+        // Relaxed accumulation allows to compute mean and variance in a
+        // single read of src.
+        , single_pass_stats_(calculate_stats_ && !skip_mean_
+                  && !has_ne_convert_src_xf16_
+                  && utils::one_of(pd_->attr()->acc_mode_,
+                          accumulation_mode::relaxed, accumulation_mode::any)) {
 
         const auto &post_ops = pd_->attr()->post_ops_;
         with_postops_ = post_ops.len() != 0;
@@ -186,6 +192,7 @@ protected:
     const float eps_;
     const bool has_ne_convert_src_xf16_;
     const bool skip_mean_;
+    const bool single_pass_stats_;
     bool with_postops_ = false;
     bool with_binary_ = false;
     bool with_eltwise_ = false;
@@ -431,6 +438,58 @@ protected:
             uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
     }
 
+    // Computes mean and variance in a single sweep over src as
+    // var = E[(x - k)^2] - E[x - k]^2, where the shift `k` is the first
+    // element of the row. The shift keeps the two terms close to the
+    // variance, which limits the cancellation compared to E[x^2] - E[x]^2.
+    void compute_mean_and_var() {
+        const int unroll = axis_simd_full_ >= 2 ? 2 : 1;
+        // Preserve `0` for tail on AVX2.
+        const Vmm vmm_sum[2] = {Vmm(1), Vmm(2)};
+        const Vmm vmm_sqr[2] = {Vmm(3), Vmm(4)};
+        const Vmm vmm_src[2] = {Vmm(5), Vmm(6)};
+
+        io_[src_d_.data_type()]->load(
+                src_ptr(), vmm_mean, /* tail = */ axis_simd_full_ == 0);
+        uni_vbroadcastss(vmm_mean, Xmm(vmm_mean.getIdx()));
+        for (int j = 0; j < unroll; j++) {
+            uni_vpxor(vmm_sum[j], vmm_sum[j], vmm_sum[j]);
+            uni_vpxor(vmm_sqr[j], vmm_sqr[j], vmm_sqr[j]);
+        }
+
+        const auto accumulate = [&](int j, size_t offt_elems, bool tail) {
+            io_[src_d_.data_type()]->load(
+                    src_ptr(offt_elems), vmm_src[j], tail);
+            uni_vsubps_maybe_tail(vmm_src[j], vmm_mean, tail);
+            uni_vaddps(vmm_sum[j], vmm_sum[j], vmm_src[j]);
+            uni_vfmadd231ps(vmm_sqr[j], vmm_src[j], vmm_src[j]);
+        };
+        for (int i = 0; i < axis_simd_full_; i++)
+            accumulate(i % unroll, i * simd_w_, false);
+        if (axis_simd_tail_ > 0)
+            accumulate(0, axis_simd_full_ * simd_w_, true);
+
+        if (unroll > 1) {
+            uni_vaddps(vmm_sum[0], vmm_sum[0], vmm_sum[1]);
+            uni_vaddps(vmm_sqr[0], vmm_sqr[0], vmm_sqr[1]);
+        }
+        reduce(vmm_sum[0], vmm_src[0]);
+        reduce(vmm_sqr[0], vmm_src[0]);
+        uni_vdivps(vmm_sum[0], vmm_sum[0], vmm_c, vmm_tmp);
+        uni_vdivps(vmm_sqr[0], vmm_sqr[0], vmm_c, vmm_tmp);
+
+        // The difference may go slightly below zero due to rounding.
+        uni_vfnmadd231ps(vmm_sqr[0], vmm_sum[0], vmm_sum[0], vmm_src[1]);
+        uni_vpxor(vmm_src[0], vmm_src[0], vmm_src[0]);
+        uni_vmaxps(vmm_inv_sqrtvar, vmm_sqr[0], vmm_src[0]);
+        uni_vaddps(vmm_mean, vmm_mean, vmm_sum[0]);
+
+        if (save_stats_) {
+            uni_vmovss(ptr[reg_mean], Xmm(vmm_mean.getIdx()));
+            uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
+        }
+    }
+
     void calculate_ne_convert_xf16_dst_body(
             size_t offt_elems, bool tail = false) {
         io_[src_d_.data_type()]->load_two_simdw_xf16(
@@ -608,7 +667,9 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
-            if (calculate_stats_) {
+            if (single_pass_stats_) {
+                compute_mean_and_var();
+            } else if (calculate_stats_) {
                 // compute stats
                 if (!skip_mean_) { compute_mean(); }
                 compute_var();
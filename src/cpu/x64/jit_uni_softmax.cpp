@@ -1613,12 +1613,11 @@ struct jit_softmax_strided_kernel_t : jit_softmax_kernel_base_t,
 // registers usage. To avoid collision and simplify the support, having a second
 // class is easier though certain pieces are same.
 jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create(
-        const softmax_pd_t *pd, const cpu_isa_t isa,
-        bool axis_is_plain_and_strided) {
+        const softmax_pd_t *pd, const cpu_isa_t isa, bool axis_is_strided) {
 
 #define HANDLE_ISA(isa_) \
     if ((isa_) == isa) { \
-        if (axis_is_plain_and_strided) \
+        if (axis_is_strided) \
             return new jit_softmax_strided_kernel_t<isa_>(pd); \
         else \
             return new jit_softmax_dense_kernel_t<isa_>(pd); \
@@ -1657,7 +1656,7 @@ jit_uni_softmax_fwd_t::jit_uni_softmax_fwd_t(const pd_t *apd)
 status_t jit_uni_softmax_fwd_t::init(engine_t *engine) {
     CHECK(safe_ptr_assign(ker_,
             softmax_impl::jit_softmax_kernel_base_t::create(
-                    pd(), pd()->isa_, pd()->axis_is_plain_and_strided_)));
+                    pd(), pd()->isa_, pd()->axis_is_strided_)));
     if (ker_) CHECK(ker_->create_kernel());
     return status::success;
 }
@@ -1682,7 +1681,8 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     const auto &bd = src_d.blocking_desc();
 
     const auto axis_stride = pd()->axis_stride();
-    const auto axis_is_blocked = axis_stride != 1 && bd.inner_nblks;
+    const auto axis_is_blocked
+            = axis_stride != 1 && bd.inner_nblks && !pd()->axis_is_strided_;
 
     dim_t inner_stride = 1;
     dim_t inner_size = 1;
@@ -1704,7 +1704,7 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     static constexpr int unroll_block_size = 64; // 4 unroll x 16 simd_w
     dim_t n_unrolled_blocks = 0;
     dim_t unroll_block_size_tail = axis_stride % unroll_block_size;
-    if (pd()->axis_is_plain_and_strided_) {
+    if (pd()->axis_is_strided_) {
         outer_stride = pd()->axis_size(true) * axis_stride;
         outer_size = src_d.nelems(true) / outer_stride;
         if (outer_size == 1) {
@@ -1739,7 +1739,7 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
                         ? scratchpad_ptr + ithr * pd()->scratch_size_per_thr_
                         : nullptr;
                 softmax_impl::jit_softmax_kernel_base_t::call_params_t p;
-                if (pd()->axis_is_plain_and_strided_ && outer_size == 1) {
+                if (pd()->axis_is_strided_ && outer_size == 1) {
                     // Special case when inner size is split between threads.
                     assert(n_unrolled_blocks > 0);
                     p.process_n_elems
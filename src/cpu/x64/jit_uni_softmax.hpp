@@ -41,7 +41,7 @@ namespace softmax_impl {
 // the kernel.
 struct jit_softmax_kernel_base_t {
     static jit_softmax_kernel_base_t *create(const softmax_pd_t *pd,
-            const cpu_isa_t isa, bool axis_is_plain_and_strided);
+            const cpu_isa_t isa, bool axis_is_strided);
 
     virtual ~jit_softmax_kernel_base_t() = default;
 
@@ -156,7 +156,9 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                     "avx2_vnni_2 only supports xf16 on plain layout");
 
             const memory_desc_wrapper dst_d(dst_md());
-            axis_is_plain_and_strided_ = dst_d.is_plain() && axis_stride() > 1;
+            // Plain layouts and blocked layouts with a non-blocked axis are
+            // vectorized over the contiguous elements following the axis.
+            axis_is_strided_ = axis_stride() > 1 && !is_axis_blocked(dst_d);
             nthr_ = dnnl_get_max_threads();
             init_scratchpad();
 
@@ -166,7 +168,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         int nthr_; // To not exceed the limit in execute used for set up.
         size_t scratch_size_per_thr_ = 0;
         cpu_isa_t isa_ = isa_undef;
-        bool axis_is_plain_and_strided_ = false;
+        bool axis_is_strided_ = false;
 
     private:
         void init_scratchpad() {
@@ -185,7 +187,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 // When stride != 1, then each thread operates over simd at a
                 // time, thus, increased scratchpad size.
                 dim_t elem_per_thr = 1;
-                if (axis_is_plain_and_strided_) {
+                if (axis_is_strided_) {
                     // Strided case has scratchpad using a simd_w for an element
                     elem_per_thr = isa_max_vlen(isa_) / sizeof(float);
                 }
@@ -235,6 +237,13 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                     && bin_po_ok;
         }
 
+        bool is_axis_blocked(const memory_desc_wrapper &mdw) const {
+            const auto &bd = mdw.blocking_desc();
+            for (int i = 0; i < bd.inner_nblks; i++)
+                if (bd.inner_idxs[i] == axis()) return true;
+            return false;
+        }
+
         bool is_dense(const cpu_isa_t isa) const {
             const memory_desc_wrapper src_d(src_md());
             const auto &bd = src_d.blocking_desc();
@@ -242,7 +251,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             if (!src_d.is_dense(true) || !src_d.only_padded_dim(axis()))
                 return false;
 
-            if (src_d.is_plain()) return true;
+            if (src_d.is_plain() || !is_axis_blocked(src_d)) return true;
 
             // It is fine to use float here as the kernel uses halfs of
             // vector registers.
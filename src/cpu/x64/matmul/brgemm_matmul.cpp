@@ -126,10 +126,13 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = src_dt == f32 && wei_dt == f16 && one_of(dst_dt, f16, f32);
     const bool is_f32_bf16
             = src_dt == f32 && wei_dt == bf16 && one_of(dst_dt, bf16, f32);
+    // f4_e2m1 weights are decompressed along with integer ones.
     const bool is_bf16_with_int_wei = src_dt == bf16
-            && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, bf16, f32);
+            && one_of(wei_dt, s8, u8, s4, u4, f4_e2m1)
+            && one_of(dst_dt, bf16, f32);
     const bool is_f16_with_int_wei = src_dt == f16
-            && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, f16, f32);
+            && one_of(wei_dt, s8, u8, s4, u4, f4_e2m1)
+            && one_of(dst_dt, f16, f32);
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -215,6 +218,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                 if (mask > 0) return false;
             }
         }
+        // f4_e2m1 weights are not shifted.
+        if (wei_dt == f4_e2m1 && !zp.has_default_values(DNNL_ARG_WEIGHTS))
+            return false;
         return true;
     };
     const bool problem_dt_correct
@@ -1638,7 +1644,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 : bgmmc_.wei_k_blk;
         int k_idx = bgmmc_.blocked_B ? k / dt_b_k_blk : k;
         int n_idx = bgmmc_.blocked_B ? n / bgmmc_.wei_n_blk : n;
-        const int int4_fac = bgmmc_.is_int4_weights ? 2 : 1;
+        const int int4_fac = bgmmc_.is_4bit_weights ? 2 : 1;
         return (B_strides_[1] * k_idx + B_strides_[0] * n_idx
                        + get_data_B_off_within_block(k, n))
                 / int4_fac;
@@ -1675,7 +1681,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         } else {
             b_off = wei_d_.off_l(b * bgmmc_.K * bgmmc_.N) * bgmmc_.b_dt_sz;
         }
-        if (bgmmc_.is_int4_weights) b_off = b_off / 2;
+        if (bgmmc_.is_4bit_weights) b_off = b_off / 2;
         return b_off;
     }
 
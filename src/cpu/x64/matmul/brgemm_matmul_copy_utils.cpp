@@ -34,6 +34,12 @@ using namespace Xbyak;
 
 #define GET_OFF(x) offsetof(ctx_t, x)
 
+// f4_e2m1 values indexed by their 4-bit codes. Unpacked codes are converted to
+// f32 with a single `vpermps` against this table.
+alignas(64) static constexpr const float f4_e2m1_lut[16] = {0.0f, 0.5f, 1.0f,
+        1.5f, 2.0f, 3.0f, 4.0f, 6.0f, -0.0f, -0.5f, -1.0f, -1.5f, -2.0f, -3.0f,
+        -4.0f, -6.0f};
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_a_impl_t : public jit_brgemm_matmul_copy_a_t,
                                          public jit_generator_t {
@@ -2905,14 +2911,16 @@ struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
         , src_stride(conf->copy_B_wei_stride)
         , tr_src_stride(conf_->LDB * k_blk_step * tr_typesize)
         , scales_N_stride(conf_->N * scales_typesize)
-        , is_src_int4(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4))
+        , is_src_4bit(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4,
+                  data_type::f4_e2m1))
+        , is_src_f4(conf->orig_wei_dt == data_type::f4_e2m1)
         , is_dynamic_stride(is_runtime_value(src_stride))
         , is_dynamic_N(conf->is_runtime_N)
         , do_N_loop(conf->LDB < conf->N_blk)
         , req_cvtps2bf16(conf->is_bf32 || conf->is_bf16_with_int_wei)
         , req_zp_b_shift(conf->has_zero_point_b && conf->with_wei_decompression)
         , req_apply_scales(conf->apply_scales_in_buffer_b)
-        , typesize_scale(is_src_int4 ? 2 : 1) {}
+        , typesize_scale(is_src_4bit ? 2 : 1) {}
 
     void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
     status_t create_kernel() override {
@@ -2930,7 +2938,8 @@ private:
     enum { k_blk_step = 2, n_blk_step = 16 };
     const int typesize, tr_typesize, scales_typesize;
     const dim_t src_stride, tr_src_stride, scales_N_stride;
-    const bool is_src_int4;
+    const bool is_src_4bit;
+    const bool is_src_f4;
     const bool is_dynamic_stride;
     const bool is_dynamic_N;
     const bool do_N_loop;
@@ -2973,6 +2982,8 @@ private:
     Vmm vmm_permw = Vmm(1);
     Vmm vmm_tmp = Vmm(1); // used only for avx2_vnni_2
     Vmm vmm_zp_b_shift = Vmm(2);
+    // f4_e2m1 weights have no zero points, so the register is shared.
+    Vmm vmm_f4_lut = Vmm(2);
     Vmm vmm_permd = Vmm(3);
 
     void kmovx(Opmask k, unsigned w) {
@@ -2996,7 +3007,7 @@ private:
         vinserti128(ymm, ymm, xmm_half, 1);
     }
     Vmm_lower_t maybe_mask(Vmm_lower_t vmm_lower, bool is_tail) {
-        assert(is_src_int4);
+        assert(is_src_4bit);
         if (isa_has_masks(conf_->isa)) {
             return is_tail ? vmm_lower | kTail_int4 | T_z
                            : vmm_lower | kFFFF | T_z;
@@ -3044,12 +3055,16 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::load_data(
             vpsrad(vmm_in | kAAAA, vmm_in, 4);
             break;
         case data_type::u4:
+        case data_type::f4_e2m1:
             uni_vpmovzxbd(maybe_mask(vmm_lower, is_tail), op);
             copy_half_int4(vmm_in, vmm_lower);
             vpermd(vmm_in, vmm_permd, vmm_in);
             uni_vpslld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            // f4_e2m1 codes are converted to f32 right away.
+            if (conf_->orig_wei_dt == data_type::f4_e2m1)
+                vpermps(vmm_in, vmm_in, vmm_f4_lut);
             break;
         default: assert(!"unsupported data type");
     }
@@ -3063,14 +3078,14 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(
     if (columns_tail > 0 && columns_tail < n_blk_step) {
         const auto tail_mask = (1 << columns_tail) - 1;
         kmovx(kTail, tail_mask);
-        if (is_src_int4) {
+        if (is_src_4bit) {
             const auto int4_tail_mask = (1 << (columns_tail / 2)) - 1;
             kmovx(kTail_int4, int4_tail_mask);
         }
     }
 
     static constexpr int blk_sz = k_blk_step;
-    const int reserved_regs = is_src_int4 ? 4 : req_zp_b_shift ? 3 : 2;
+    const int reserved_regs = is_src_4bit ? 4 : req_zp_b_shift ? 3 : 2;
     const int max_isa_regs = isa_num_vregs(conf_->isa);
     const int max_regs_available = max_isa_regs - reserved_regs;
     const int max_unroll = max_regs_available / blk_sz;
@@ -3103,9 +3118,12 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(
         }
 
         if (utils::one_of(conf_->orig_wei_dt, data_type::s8, data_type::u8,
-                    data_type::s4, data_type::u4)) {
-            if (req_zp_b_shift) uni_vpsubd(src_load, src_load, vmm_zp_b_shift);
-            uni_vcvtdq2ps(src_load, src_load);
+                    data_type::s4, data_type::u4, data_type::f4_e2m1)) {
+            if (!is_src_f4) {
+                if (req_zp_b_shift)
+                    uni_vpsubd(src_load, src_load, vmm_zp_b_shift);
+                uni_vcvtdq2ps(src_load, src_load);
+            }
             if (req_apply_scales) {
                 const auto scales_offset
                         = (is_dynamic_stride ? 0 : k * scales_N_stride)
@@ -3205,7 +3223,7 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::init_masks() {
         mov(reg_tmp, reinterpret_cast<size_t>(bf16_vnni_permute));
         vmovdqa64(vmm_permw, ptr[reg_tmp]);
 
-        if (is_src_int4) {
+        if (is_src_4bit) {
             alignas(64) static constexpr const uint32_t int4_permute[16]
                     = {0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15};
             mov(reg_tmp, reinterpret_cast<size_t>(int4_permute));
@@ -3214,6 +3232,10 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::init_masks() {
             kmovx(kAAAA, 0xaaaa);
             kmovx(k5555, 0x5555);
         }
+        if (is_src_f4) {
+            mov(reg_tmp, reinterpret_cast<size_t>(f4_e2m1_lut));
+            vmovups(vmm_f4_lut, ptr[reg_tmp]);
+        }
     }
 }
 
@@ -3417,12 +3439,14 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
         , jit_generator_t(jit_name())
         , dt_in_(conf->orig_wei_dt)
         , simd_w_(vreg_traits_t<Vmm>::vlen / sizeof(float))
-        , is_src_int4_(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4))
+        , is_src_4bit_(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4,
+                  data_type::f4_e2m1))
+        , is_src_f4_(conf->orig_wei_dt == data_type::f4_e2m1)
         , req_zp_b_shift_(
                   conf->has_zero_point_b && conf->with_wei_decompression)
         , req_apply_scales_(conf->apply_scales_in_buffer_b)
         , typesize_in_(types::data_type_size(dt_in_))
-        , typesize_scale_(is_src_int4_ ? 2 : 1)
+        , typesize_scale_(is_src_4bit_ ? 2 : 1)
         , scales_typesize_(sizeof(float))
         , src_stride_(conf_->copy_B_wei_stride)
         , tr_src_stride_(conf_->LDB * typesize_out_)
@@ -3441,7 +3465,7 @@ private:
 
     const data_type_t dt_in_;
     const int simd_w_;
-    const bool is_src_int4_, req_zp_b_shift_, req_apply_scales_;
+    const bool is_src_4bit_, is_src_f4_, req_zp_b_shift_, req_apply_scales_;
     const size_t typesize_in_, typesize_scale_, scales_typesize_;
     const size_t typesize_out_ = sizeof(float);
     dim_t src_stride_, tr_src_stride_, scales_N_stride_;
@@ -3466,6 +3490,8 @@ private:
     Vmm vmm_permw = Vmm(1);
     Vmm vmm_permd = Vmm(2);
     Vmm vmm_zp_b_shift = Vmm(3);
+    // f4_e2m1 weights have no zero points, so the register is shared.
+    Vmm vmm_f4_lut = Vmm(3);
     Ymm ymm_tail_mask = ymm1;
 
     inline void kmovw(Opmask k, unsigned w) {
@@ -3480,7 +3506,7 @@ private:
         vinserti128(ymm, ymm, xmm_half, 1);
     }
     Vmm_lower_t maybe_mask(Vmm_lower_t vmm_lower, bool is_tail) {
-        assert(is_src_int4_);
+        assert(is_src_4bit_);
         return is_tail && isa_has_masks(conf_->isa)
                 ? vmm_lower | kTail_int4 | T_z
                 : vmm_lower;
@@ -3530,12 +3556,16 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::load_data(
             vpsrad(vmm_in | kAAAA, vmm_in, 4);
             break;
         case data_type::u4:
+        case data_type::f4_e2m1:
             uni_vpmovzxbd(maybe_mask(vmm_lower, is_tail), op);
             copy_half_int4(vmm_in, vmm_lower);
             vpermd(vmm_in, vmm_permd, vmm_in);
             uni_vpslld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            // f4_e2m1 codes are converted to f32 right away.
+            if (conf_->orig_wei_dt == data_type::f4_e2m1)
+                vpermps(vmm_in, vmm_in, vmm_f4_lut);
             break;
         default: assert(!"unsupported data type");
     }
@@ -3549,7 +3579,8 @@ template <typename Vmm>
 void jit_brgemm_matmul_copy_b_f32_t<Vmm>::copy_16_x_n_block(
         int nrows, int ncolumns) {
     const int max_isa_regs = isa_num_vregs(conf_->isa);
-    const int reserved_regs = req_zp_b_shift_ ? 4 : is_src_int4_ ? 3 : 2;
+    const int reserved_regs
+            = req_zp_b_shift_ || is_src_f4_ ? 4 : is_src_4bit_ ? 3 : 2;
     const int max_regs_available = max_isa_regs - reserved_regs;
 
     auto get_vmm = [max_regs_available, reserved_regs](int reg_idx) {
@@ -3583,7 +3614,7 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::copy_16_x_n_block(
         if (isa_has_masks(conf_->isa)) {
             const auto tail_mask = (1 << columns_tail) - 1;
             kmovw(kTail, tail_mask);
-            if (is_src_int4_) {
+            if (is_src_4bit_) {
                 const auto int4_tail_mask
                         = (1 << (columns_tail / typesize_scale_)) - 1;
                 kmovw(kTail_int4, int4_tail_mask);
@@ -3652,7 +3683,7 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::generate() {
     mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
     mov(reg_scales, ptr[param1 + GET_OFF(scales_ptr)]);
     kmovw(kFFFF, 0xffff); // 1111111111111111
-    if (is_src_int4_) {
+    if (is_src_4bit_) {
         alignas(64) static constexpr const uint32_t int4_permute[16]
                 = {0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15};
         mov(reg_tmp, reinterpret_cast<size_t>(int4_permute));
@@ -3661,6 +3692,10 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::generate() {
         kmovw(kAAAA, 0xaaaa);
         kmovw(k5555, 0x5555);
     }
+    if (is_src_f4_) {
+        mov(reg_tmp, reinterpret_cast<size_t>(f4_e2m1_lut));
+        vmovups(vmm_f4_lut, ptr[reg_tmp]);
+    }
     if (req_zp_b_shift_) {
         mov(reg_tmp, ptr[param1 + GET_OFF(zp_b_value_ptr)]);
         uni_vpbroadcastd(vmm_zp_b_shift, ptr[reg_tmp]);
@@ -3705,7 +3740,9 @@ struct jit_brgemm_matmul_copy_b_transposed_t
                   conf_->has_zero_point_a || conf_->s8s8_compensation_required)
         , is_bf32_(conf->is_bf32)
         , is_bf16_with_int_wei_(conf->is_bf16_with_int_wei)
-        , is_src_int4_(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4))
+        , is_src_4bit_(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4,
+                  data_type::f4_e2m1))
+        , is_src_f4_(conf->orig_wei_dt == data_type::f4_e2m1)
         , req_cvtps2xf16_(conf->is_bf32 || conf->is_bf16_with_int_wei
                   || (conf->is_f16_with_int_wei
                           && conf->wei_dt == data_type::f16))
@@ -3729,13 +3766,13 @@ struct jit_brgemm_matmul_copy_b_transposed_t
                   - (avx512_core_dot_product_
                                   ? 8
                                   : (do_compute_compensation_       ? 6
-                                                  : is_src_int4_    ? 2
+                                                  : is_src_4bit_    ? 2
                                                   : req_zp_b_shift_ ? 1
                                                                     : 0)))
         , src_stride_(conf_->copy_B_wei_stride)
         , tr_src_stride_(conf_->LDB * vnni_granularity_ * tr_typesize_)
         , scales_K_stride_(conf_->K * scales_typesize_)
-        , typesize_scale_(is_src_int4_ ? 2 : 1)
+        , typesize_scale_(is_src_4bit_ ? 2 : 1)
         , is_dynamic_N_(conf->is_runtime_N) {}
 
     void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
@@ -3765,7 +3802,8 @@ private:
     const bool do_compute_compensation_;
     const bool is_bf32_;
     const bool is_bf16_with_int_wei_;
-    const bool is_src_int4_;
+    const bool is_src_4bit_;
+    const bool is_src_f4_;
     const bool req_cvtps2xf16_;
     const bool req_zp_comp_;
     const bool req_s8s8_comp_;
@@ -3824,6 +3862,8 @@ private:
     Vmm vmm_dot_product_temp = Vmm(max_vmm_regs_ - 8);
 
     Vmm vmm_zp_b_val = Vmm(max_vmm_regs_ - 1);
+    // f4_e2m1 weights have no zero points, so the register is shared.
+    Vmm vmm_f4_lut = Vmm(max_vmm_regs_ - 1);
     Vmm vmm_permd = Vmm(max_vmm_regs_ - 2);
 
     void kmovw(Opmask k, unsigned w) {
@@ -3857,7 +3897,7 @@ private:
     }
 
     Vmm_lower_t maybe_mask(Vmm_lower_t vmm_lower, bool is_tail) {
-        assert(is_src_int4_);
+        assert(is_src_4bit_);
         return isa_has_masks(conf_->isa) && is_tail
                 ? vmm_lower | kTail_int4 | T_z
                 : vmm_lower;
@@ -3919,7 +3959,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::maybe_apply_zp_b_shift(
 template <typename Vmm>
 void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::init_tail_mask(
         const int columns_tail, const bool use_int4_mask) {
-    assert(IMPLICATION(use_int4_mask, is_src_int4_));
+    assert(IMPLICATION(use_int4_mask, is_src_4bit_));
     if (columns_tail > 0) {
         const int dt_step = req_cvtps2xf16_ || use_fp16_instructions_
                         || use_bf16_instructions_
@@ -3944,7 +3984,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::load_int(const Vmm vmm_in,
     const auto addr = EVEX_compress_addr(reg_src, offset);
     MAYBE_UNUSED(xmm_in);
     MAYBE_UNUSED(vmm_lower);
-    if (is_src_int4_) init_tail_mask(columns_tail, true);
+    if (is_src_4bit_) init_tail_mask(columns_tail, true);
 
     // Two additional operations are needed for int4 when i * src_stride_ % 2 != 0.
     // The maximum data size for a bitwise shift is 8 bytes (quadwords).
@@ -3952,7 +3992,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::load_int(const Vmm vmm_in,
     // shift to eliminate the unnecessary half-byte at the front.
     // If the loaded data size is 8, we need two registers to handle the
     // unnecessary half-byte at the front and back, respectively.
-    const bool need_preload_int4 = is_src_int4_ && (i * src_stride_) % 2 != 0;
+    const bool need_preload_int4 = is_src_4bit_ && (i * src_stride_) % 2 != 0;
     const auto max_shift_sz = 8;
     if (need_preload_int4) {
         const auto load_sz = is_tail ? div_up(columns_tail, 2)
@@ -3992,6 +4032,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::load_int(const Vmm vmm_in,
             vpsrad(vmm_in | kAAAA, vmm_in, 4);
             break;
         case data_type::u4:
+        case data_type::f4_e2m1:
             if (need_preload_int4)
                 uni_vpmovzxbd(maybe_mask(vmm_lower, is_tail), xmm_in);
             else
@@ -4001,11 +4042,13 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::load_int(const Vmm vmm_in,
             uni_vpslld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            // f4_e2m1 codes are converted to f32 right away.
+            if (is_src_f4_) vpermps(vmm_in, vmm_in, vmm_f4_lut);
             break;
         default: assert(!"unsupported data type");
     }
     // restore the tail_mask
-    if (is_src_int4_) init_tail_mask(columns_tail, false);
+    if (is_src_4bit_) init_tail_mask(columns_tail, false);
 }
 
 template <typename Vmm>
@@ -4052,7 +4095,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::copy_row_x_col(
                     = columns_tail > 0 && ncolumns < req_cvt_bf16_k_blk_step_;
             load_int(src_reg, src_offset, i, columns_tail, is_tail);
             maybe_apply_zp_b_shift(src_reg, is_tail);
-            vcvtdq2ps(zmm_src, zmm_src);
+            if (!is_src_f4_) vcvtdq2ps(zmm_src, zmm_src);
             maybe_apply_scales(src_reg, i * scales_K_stride_, is_tail);
         } else
             assert(!"Unsupported data type in loading");
@@ -4073,7 +4116,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::copy_row_x_col(
                 load_int(src_reg_next, next_src_offset, i, columns_tail,
                         columns_tail > 0);
                 maybe_apply_zp_b_shift(src_reg_next, is_tail);
-                vcvtdq2ps(zmm_src_next, zmm_src_next);
+                if (!is_src_f4_) vcvtdq2ps(zmm_src_next, zmm_src_next);
                 maybe_apply_scales(src_reg_next,
                         i * scales_K_stride_
                                 + req_cvt_bf16_k_blk_step_ * scales_typesize_,
@@ -4120,7 +4163,7 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::copy_row_x_col(
         if (conf_->is_f16_with_int_wei && conf_->wei_dt == data_type::f32) {
             load_int(src_reg, src_offset, i, columns_tail, is_tail);
             maybe_apply_zp_b_shift(src_reg, is_tail);
-            vcvtdq2ps(src_load, src_load);
+            if (!is_src_f4_) vcvtdq2ps(src_load, src_load);
             maybe_apply_scales(src_reg, i * scales_K_stride_, is_tail);
         } else if (use_fp16_instructions_) {
             if (conf_->isa == avx512_core_fp16) {
@@ -4553,12 +4596,16 @@ void jit_brgemm_matmul_copy_b_transposed_t<Vmm>::generate() {
         kmovw(k0F0F, 0x0f0f);
         kmovw(kF0F0, 0xf0f0);
     }
-    if (is_src_int4_ && is_superset(conf_->isa, avx512_core)) {
+    if (is_src_4bit_ && is_superset(conf_->isa, avx512_core)) {
         alignas(64) static constexpr const uint32_t int4_permute[16]
                 = {0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15};
         mov(regq_tmp, reinterpret_cast<size_t>(int4_permute));
         vmovdqa32(vmm_permd, ptr[regq_tmp]);
     }
+    if (is_src_f4_ && is_superset(conf_->isa, avx512_core)) {
+        mov(regq_tmp, reinterpret_cast<size_t>(f4_e2m1_lut));
+        vmovups(vmm_f4_lut, ptr[regq_tmp]);
+    }
 
     const dim_t N_chunk_elems = conf_->N_chunk_elems;
     assert(N_chunk_elems % n_blk_step_ == 0 || N_chunk_elems == conf_->N);
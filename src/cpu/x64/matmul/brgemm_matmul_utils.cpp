@@ -213,6 +213,23 @@ bool is_batch_layout_trivial(
     return max_batch_stride / min_batch_stride == batch;
 }
 
+// Checks if weights can be up-converted to the source data type while copying
+// them into the B buffer.
+bool is_weights_decompression_supported(
+        const brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr) {
+    // f4_e2m1 values are exact in both bf16 and f16, so converting them
+    // doesn't require an fpmath mode.
+    if (bgmmc.wei_dt == f4_e2m1) return one_of(bgmmc.src_dt, bf16, f16);
+
+    const auto mode = attr.fpmath_.mode_;
+    return one_of(bgmmc.wei_dt, u8, s8, u4, s4)
+            && one_of(mode, fpmath_mode::bf16, fpmath_mode::f16,
+                    fpmath_mode::any)
+            && IMPLICATION(mode == fpmath_mode::f16, bgmmc.src_dt == f16)
+            && IMPLICATION(mode == fpmath_mode::bf16, bgmmc.src_dt == bf16)
+            && attr.fpmath_.apply_to_int_;
+}
+
 status_t check_isa_with_datatype(
         const cpu_isa_t isa, const brgemm_matmul_conf_utils_t &bm_conf_utils) {
     const bool ok
@@ -290,14 +307,8 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
     , tf32_dt(f32_dt
               && one_of(attr.fpmath_.mode_, fpmath_mode::tf32, fpmath_mode::any)
               && isa == avx10_2_512_amx_2)
-    , weights_decompression_support(one_of(bgmmc.wei_dt, u8, s8, u4, s4)
-              && one_of(attr.fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::f16,
-                      fpmath_mode::any)
-              && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::f16,
-                      bgmmc.src_dt == f16)
-              && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::bf16,
-                      bgmmc.src_dt == bf16)
-              && attr.fpmath_.apply_to_int_)
+    , weights_decompression_support(
+              is_weights_decompression_supported(bgmmc, attr))
     , bf16_with_int_wei_dt(weights_decompression_support && bgmmc.src_dt == bf16
               && one_of(bgmmc.dst_dt, bf16, f32))
     // Keep this var separate from f16_dt to not slip f16:f16 on avx512_core and
@@ -367,9 +378,9 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(memory_desc_t &B_md,
                 ? get_default_n_block(format_tag::undef)
                 : bgmmc.N_blk;
         bgmmc.wei_tag = blocked_B_layouts_allowed && !bgmmc.is_runtime_N
-                        && !bgmmc.is_int4_weights
+                        && !bgmmc.is_4bit_weights
                 ? this->pick_blocked_B_layout(default_n_block)
-                : bgmmc.is_int4_weights && bgmmc.N % 2 != 0
+                : bgmmc.is_4bit_weights && bgmmc.N % 2 != 0
                 ? transposed_tensor_layout_tag
                 : plain_tensor_layout_tag;
         VCONDCHECK_BG(
@@ -385,7 +396,7 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(memory_desc_t &B_md,
         }
     } else {
         bgmmc.wei_tag = blocked_B_layouts_allowed && !bgmmc.is_runtime_N
-                        && !bgmmc.is_int4_weights
+                        && !bgmmc.is_4bit_weights
                 ? memory_desc_matches_one_of_tag(B_md, plain_tensor_layout_tag,
                         transposed_tensor_layout_tag, blocked_64n_B_layout_tag,
                         blocked_48n_B_layout_tag, blocked_32n_B_layout_tag,
@@ -1227,7 +1238,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_f32_f16 = bm_conf_utils.is_f32_f16();
     bgmmc.is_f32_bf16 = bm_conf_utils.is_f32_bf16();
     bgmmc.with_wei_decompression = bm_conf_utils.with_weights_decompression();
-    bgmmc.is_int4_weights = one_of(bgmmc.wei_dt, data_type::s4, data_type::u4);
+    bgmmc.is_4bit_weights = one_of(bgmmc.wei_dt, data_type::s4, data_type::u4,
+            data_type::f4_e2m1);
 
     // Make BRGeMM compute MatMul as if it were in bfloat16, while down-convert
     // happens during copy-buffer computations
@@ -1391,10 +1403,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         bgmmc.tr_b_dt_sz = types::data_type_size(f32);
     }
 
-    // int4 weights decompression only supports plain and transpose layouts
+    // 4-bit weights decompression only supports plain and transpose layouts
     // TODO: enable int4 reorder and extend support to blocked weights
     // layout when needed
-    if (bgmmc.with_wei_decompression && bgmmc.is_int4_weights)
+    if (bgmmc.with_wei_decompression && bgmmc.is_4bit_weights)
         VCONDCHECK_BG(bm_conf_utils.check_is_plain(bgmmc.wei_tag)
                         || bm_conf_utils.check_is_transposed(bgmmc.wei_tag),
                 VERBOSE_UNSUPPORTED_TAG);
@@ -1625,7 +1637,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     // When is_wei_batch_layout_trivial is true, we only support that
     // batch offset can be divided by 2
-    if (bgmmc.is_int4_weights) {
+    if (bgmmc.is_4bit_weights) {
         VCONDCHECK_BG(IMPLICATION(bgmmc.is_wei_batch_layout_trivial
                                       && bgmmc.batch > 1,
                               bgmmc.B_strides[2] % 2 == 0),
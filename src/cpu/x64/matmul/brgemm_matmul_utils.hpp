@@ -216,7 +216,8 @@ struct brgemm_matmul_conf_t {
     bool is_f16_with_int_wei = false;
     bool is_f32_f16 = false;
     bool is_f32_bf16 = false;
-    bool is_int4_weights = false;
+    // s4, u4 and f4_e2m1 weights pack two values per byte.
+    bool is_4bit_weights = false;
     bool is_tf32 = false;
     bool req_wei_vnni_downconvert = false;
     bool is_runtime_M = false;
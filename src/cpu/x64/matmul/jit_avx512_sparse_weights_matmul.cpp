@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/matmul/jit_avx512_sparse_weights_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace Xbyak;
+
+struct sparse_weights_matmul_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(sparse_weights_matmul_kernel_t)
+
+    struct call_params_t {
+        const float *src;
+        const float *wei_values;
+        const int32_t *wei_indices, *wei_pointers;
+        float *dst;
+    };
+
+    sparse_weights_matmul_kernel_t(dim_t K, dim_t N)
+        : jit_generator_t(jit_name(), avx512_core), K_(K), N_(N) {}
+
+    void operator()(const call_params_t *p) const {
+        jit_generator_t::operator()(p);
+    }
+
+private:
+    const int simd_w_ = cpu_isa_traits_t<avx512_core>::vlen / sizeof(float);
+    const dim_t K_;
+    const dim_t N_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = r8;
+    Reg64 reg_wei_values = r9;
+    Reg64 reg_wei_indices = r10;
+    Reg64 reg_wei_pointers = r11;
+    Reg64 reg_dst = r12;
+    Reg64 reg_k = r13;
+    Reg64 reg_nnz_begin = r14;
+    Reg64 reg_nnz_end = r15;
+    Reg64 reg_src_val = rax;
+    Reg64 reg_tmp = rbx;
+    // `shl` takes a dynamic shift from `cl` only.
+    Reg64 reg_nnz_tail = rcx;
+
+    Opmask k_full = Opmask(1);
+    Opmask k_tail = Opmask(2);
+    Opmask k_gather = Opmask(3);
+
+    Zmm zmm_zero = Zmm(0);
+    Zmm zmm_src = Zmm(1);
+    Zmm zmm_idx = Zmm(2);
+    Zmm zmm_val = Zmm(3);
+    Zmm zmm_acc = Zmm(4);
+
+    void zero_dst() {
+        const dim_t n_full = N_ / simd_w_ * simd_w_;
+        const dim_t n_tail = N_ % simd_w_;
+
+        vpxord(zmm_zero, zmm_zero, zmm_zero);
+        if (n_full > 0) {
+            Label loop;
+            xor_(reg_tmp, reg_tmp);
+            L(loop);
+            {
+                vmovups(ptr[reg_dst + reg_tmp * sizeof(float)], zmm_zero);
+                add(reg_tmp, simd_w_);
+                cmp(reg_tmp, n_full);
+                jl(loop, T_NEAR);
+            }
+        }
+        if (n_tail > 0) {
+            mov(reg_tmp.cvt32(), (1 << n_tail) - 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+            vmovups(ptr[reg_dst + n_full * sizeof(float)] | k_tail, zmm_zero);
+        }
+    }
+
+    // dst[wei_indices[j]] += src[k] * wei_values[j] for the `mask` lanes of
+    // the current chunk of the row. Column indices are unique within a row,
+    // hence the scatter has no conflicts.
+    void scatter_fma(const Opmask &mask, bool is_tail) {
+        const auto idx_addr = ptr[reg_wei_indices + reg_nnz_begin * 4];
+        const auto val_addr
+                = ptr[reg_wei_values + reg_nnz_begin * sizeof(float)];
+        if (is_tail) {
+            vmovdqu32(zmm_idx | mask | T_z, idx_addr);
+            vmovups(zmm_val | mask | T_z, val_addr);
+        } else {
+            vmovdqu32(zmm_idx, idx_addr);
+            vmovups(zmm_val, val_addr);
+        }
+        // Gather and scatter clear the mask on completion.
+        kmovw(k_gather, mask);
+        vgatherdps(zmm_acc | k_gather, ptr[reg_dst + zmm_idx * sizeof(float)]);
+        vfmadd231ps(zmm_acc, zmm_src, zmm_val);
+        kmovw(k_gather, mask);
+        vscatterdps(ptr[reg_dst + zmm_idx * sizeof(float)] | k_gather, zmm_acc);
+    }
+
+    void generate() override {
+        preamble();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_wei_values, ptr[reg_param + PARAM_OFF(wei_values)]);
+        mov(reg_wei_indices, ptr[reg_param + PARAM_OFF(wei_indices)]);
+        mov(reg_wei_pointers, ptr[reg_param + PARAM_OFF(wei_pointers)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+#undef PARAM_OFF
+
+        zero_dst();
+        kxnorw(k_full, k_full, k_full);
+
+        Label loop_k, loop_k_end, next_k, loop_nnz, nnz_tail;
+        xor_(reg_k, reg_k);
+        L(loop_k);
+        {
+            cmp(reg_k, K_);
+            je(loop_k_end, T_NEAR);
+
+            // Zero source values do not contribute to the row.
+            mov(reg_src_val.cvt32(), dword[reg_src + reg_k * sizeof(float)]);
+            test(reg_src_val.cvt32(), 0x7fffffff);
+            jz(next_k, T_NEAR);
+
+            // Neither do empty weights rows.
+            movsxd(reg_nnz_begin, dword[reg_wei_pointers + reg_k * 4]);
+            movsxd(reg_nnz_end, dword[reg_wei_pointers + reg_k * 4 + 4]);
+            cmp(reg_nnz_begin, reg_nnz_end);
+            je(next_k, T_NEAR);
+
+            vpbroadcastd(zmm_src, reg_src_val.cvt32());
+
+            L(loop_nnz);
+            {
+                mov(reg_nnz_tail, reg_nnz_end);
+                sub(reg_nnz_tail, reg_nnz_begin);
+                cmp(reg_nnz_tail, simd_w_);
+                jl(nnz_tail, T_NEAR);
+
+                scatter_fma(k_full, /* is_tail = */ false);
+                add(reg_nnz_begin, simd_w_);
+                jmp(loop_nnz, T_NEAR);
+            }
+
+            L(nnz_tail);
+            test(reg_nnz_tail, reg_nnz_tail);
+            jz(next_k, T_NEAR);
+            mov(reg_tmp, 1);
+            shl(reg_tmp, cl);
+            sub(reg_tmp, 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+            scatter_fma(k_tail, /* is_tail = */ true);
+
+            L(next_k);
+            add(reg_k, 1);
+            jmp(loop_k, T_NEAR);
+        }
+        L(loop_k_end);
+
+        postamble();
+    }
+};
+
+jit_avx512_sparse_weights_matmul_t::jit_avx512_sparse_weights_matmul_t(
+        const pd_t *apd)
+    : primitive_t(apd) {}
+jit_avx512_sparse_weights_matmul_t::~jit_avx512_sparse_weights_matmul_t()
+        = default;
+
+status_t jit_avx512_sparse_weights_matmul_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new sparse_weights_matmul_kernel_t(pd()->K(), pd()->N())));
+    return kernel_->create_kernel();
+}
+
+status_t jit_avx512_sparse_weights_matmul_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei_values = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
+    const auto *wei_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto *wei_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+
+    // CSR: index 1 - column indices, index 2 - row pointers.
+    // COO: index 1 - row indices, index 2 - column indices.
+    const int32_t *wei_indices = wei_buffer_1;
+    const int32_t *wei_pointers = wei_buffer_2;
+    if (wei_d.encoding() == sparse_encoding::coo) {
+        int32_t *wei_row_pointers
+                = ctx.get_scratchpad_grantor().template get<int32_t>(
+                        memory_tracking::names::key_matmul_sparse_tmp_ptr);
+        utils::array_set(wei_row_pointers, 0, K + 1);
+        // COO entries are sorted by rows.
+        const dim_t nnz = wei_d.nnz();
+        for (dim_t i = 0; i < nnz; i++)
+            wei_row_pointers[wei_buffer_1[i] + 1]++;
+        for (dim_t k = 0; k < K; k++)
+            wei_row_pointers[k + 1] += wei_row_pointers[k];
+
+        wei_indices = wei_buffer_2;
+        wei_pointers = wei_row_pointers;
+    }
+
+    parallel_nd(M, [&](dim_t m) {
+        sparse_weights_matmul_kernel_t::call_params_t p;
+        p.src = src + m * K;
+        p.wei_values = wei_values;
+        p.wei_indices = wei_indices;
+        p.wei_pointers = wei_pointers;
+        p.dst = dst + m * N;
+        (*kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_AVX512_SPARSE_WEIGHTS_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_AVX512_SPARSE_WEIGHTS_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct sparse_weights_matmul_kernel_t;
+
+// Matmul with dense source and CSR or COO encoded weights. Each row of the
+// destination is accumulated by scattering the non-zero weights of the rows
+// selected by non-zero source values, so empty weights rows and zero source
+// values are skipped entirely.
+struct jit_avx512_sparse_weights_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                "jit:avx512_core", jit_avx512_sparse_weights_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper wei_d(weights_md(0));
+
+            VDISPATCH_MATMUL(wei_d.is_sparse_desc() && !src_d.is_sparse_desc(),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            const bool is_csr = wei_d.encoding() == sparse_encoding::csr;
+            const bool is_coo = wei_d.encoding() == sparse_encoding::coo;
+            VDISPATCH_MATMUL(is_csr || is_coo, VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(wei_d.metadata_type(0) == s32
+                            && IMPLICATION(
+                                    is_csr, wei_d.metadata_type(1) == s32),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(utils::everyone_is(f32, src_md(0)->data_type,
+                                     weights_md(0)->data_type,
+                                     dst_md(0)->data_type),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+            VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_MATMUL(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(mayiuse(avx512_core), VERBOSE_UNSUPPORTED_ISA);
+            VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        bool formats_ok() const {
+            return memory_desc_wrapper(src_md()).matches_one_of_tag(
+                           format_tag::ab)
+                    && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                            format_tag::ab);
+        }
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            // COO row indices are compressed to CSR pointers.
+            if (memory_desc_wrapper(weights_md(0)).encoding()
+                    != sparse_encoding::coo)
+                return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<int32_t>(
+                    key_matmul_sparse_tmp_ptr, K() + 1);
+        }
+    };
+
+    jit_avx512_sparse_weights_matmul_t(const pd_t *apd);
+    ~jit_avx512_sparse_weights_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<sparse_weights_matmul_kernel_t> kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+#endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023-2025 Intel Corporation
+* Copyright 2023-2026 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -23,6 +23,10 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
@@ -36,14 +40,42 @@ namespace matmul {
 using namespace dnnl::impl::data_type;
 using namespace Xbyak;
 
+namespace {
+const bcast_set_t &get_supported_postops_bcast_strategies() {
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::no_broadcast};
+    return supported_strategies;
+}
+} // namespace
+
+bool jit_uni_sparse_matmul_t::pd_t::post_ops_ok() const {
+    const memory_desc_wrapper dst_d(dst_md());
+    const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    static constexpr bool sum_at_pos_0_only = false;
+    static constexpr bool sum_requires_scale_one = false;
+    static constexpr bool sum_requires_zp_zero = true;
+    static constexpr bool sum_requires_same_params = false;
+    return injector::post_ops_ok(injector::post_ops_ok_args_t(isa,
+            {injector::sum, injector::eltwise, injector::binary},
+            attr()->post_ops_, &dst_d, sum_at_pos_0_only,
+            sum_requires_scale_one, sum_requires_zp_zero,
+            sum_requires_same_params,
+            get_supported_postops_bcast_strategies()));
+}
+
 struct sparse_matmul_kernel_t : public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(sparse_matmul_kernel_t);
 
     struct call_params_t {
         const int32_t *src_indices;
-        const float *src_values, *wei, *dst;
+        const void *src_values, *wei, *bias;
+        void *dst;
+        const float *scales, *dst_scales;
         size_t block_size;
         size_t nnz;
+        const void *dst_orig;
+        const void *post_ops_binary_rhs_arg_vec;
     };
 
     sparse_matmul_kernel_t(size_t vlen, const matmul_pd_t *pd)
@@ -52,7 +84,16 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
         , vlen_(vlen)
         , simd_w_(vlen_ / data_type_size())
         , tail_block_size_(N() % block_size())
-        , tail_size_(tail_block_size() % simd_w()) {}
+        , tail_size_(tail_block_size() % simd_w())
+        , wei_dt_(pd->weights_md(0)->data_type)
+        , dst_dt_(pd->dst_md()->data_type)
+        , bias_dt_(pd->with_bias() ? pd->weights_md(1)->data_type : undef)
+        , with_scales_(!pd->attr()->scales_.has_default_values(
+                  {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS}))
+        , with_per_n_scales_(
+                  pd->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS) > 0)
+        , with_dst_scales_(
+                  !pd->attr()->scales_.has_default_values(DNNL_ARG_DST)) {}
 
     ~sparse_matmul_kernel_t() override = default;
 
@@ -65,8 +106,13 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
     size_t tail_block_size() const { return tail_block_size_; }
     size_t tail_size() const { return tail_size_; }
 
+    // Accumulation data type size.
     int data_type_size() const { return sizeof(float); }
     int index_type_size() const { return sizeof(int32_t); }
+    // Sparse values share the data type with weights.
+    int wei_type_size() const { return types::data_type_size(wei_dt_); }
+    int dst_type_size() const { return types::data_type_size(dst_dt_); }
+    int bias_type_size() const { return types::data_type_size(bias_dt_); }
 
     int block_size() const { return vlen(); }
 
@@ -80,6 +126,12 @@ protected:
     size_t simd_w_;
     size_t tail_block_size_;
     size_t tail_size_;
+    data_type_t wei_dt_;
+    data_type_t dst_dt_;
+    data_type_t bias_dt_;
+    bool with_scales_;
+    bool with_per_n_scales_;
+    bool with_dst_scales_;
 };
 
 template <cpu_isa_t isa>
@@ -110,11 +162,32 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     Reg64 reg_tmp = r14;
     Reg64 reg_nnz = r15;
 
+    // Post-ops injectors preserve the helpers, so the registers may be used
+    // by the kernel as well.
+    Reg64 reg_po_helper_1 = abi_not_param1;
+    Reg64 reg_po_helper_2 = rbp;
+    Reg64 reg_po_helper_3 = reg_nnz_count;
+
     Opmask tail_opmask = Opmask(2);
+    Opmask eltwise_opmask = Opmask(3);
     Vmm tail_vmask = Vmm(0);
 
     Vmm vreg_src_val = Vmm(isa == avx512_core ? 19 : 11);
-    Xmm xreg_src_val = Xmm(11);
+    Xmm xreg_src_val = Xmm(vreg_src_val.getIdx());
+    Vmm vreg_rhs_helper = Vmm(isa == avx512_core ? 20 : 12);
+
+    Zmm bf16_emu_reserv_1 = Zmm(27);
+    Zmm bf16_emu_reserv_2 = Zmm(28);
+    Zmm bf16_emu_reserv_3 = Zmm(29);
+    Zmm bf16_emu_reserv_4 = Zmm(30);
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa, Vmm>>
+            postops_injector_;
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+    bool with_sum_ = false;
+    float sum_scale_ = 0.f;
+    bool with_binary_ = false;
+    bool with_postops_ = false;
 
     void load_kernel_params() {
 #define PARAM_OFF(x) offsetof(call_params_t, x)
@@ -128,19 +201,19 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
     Address wei_ptr(size_t offt = 0) {
         if (N() == 1)
-            return ptr[reg_wei + reg_src_col_idx * data_type_size() + offt];
+            return ptr[reg_wei + reg_src_col_idx * wei_type_size() + offt];
 
         imul(reg_tmp, reg_src_col_idx, N());
         add(reg_tmp, reg_block_offset);
-        return ptr[reg_wei + reg_tmp * data_type_size() + offt];
+        return ptr[reg_wei + reg_tmp * wei_type_size() + offt];
     }
 
     Address dst_ptr(size_t offt = 0) {
-        return ptr[reg_dst + reg_block_offset * data_type_size() + offt];
+        return ptr[reg_dst + reg_block_offset * dst_type_size() + offt];
     }
 
     Address src_values_ptr(size_t offt = 0) {
-        return ptr[reg_src_values + reg_nnz_count * data_type_size() + offt];
+        return ptr[reg_src_values + reg_nnz_count * wei_type_size() + offt];
     }
 
     Address src_indices_ptr(size_t offt = 0) {
@@ -148,6 +221,13 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
                 + offt];
     }
 
+    // Per N arguments of the current block, the argument pointer is loaded to
+    // `reg_tmp`.
+    Address per_n_arg_ptr(size_t param_offt, int type_size, size_t offt) {
+        mov(reg_tmp, ptr[reg_param + param_offt]);
+        return ptr[reg_tmp + reg_block_offset * type_size + offt];
+    }
+
     void load_tail(const Zmm &dst, const Address &src) {
         uni_vmovups_tail(dst, tail_opmask, src);
     }
@@ -164,6 +244,53 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         uni_vmovups_tail(dst, tail_vmask, src);
     }
 
+    // Loads `simd_w` values converting them to f32. bf16 is dispatched for
+    // AVX-512 only.
+    void load_data(data_type_t dt, const Vmm &dst, const Address &src,
+            bool is_tail) {
+        if (dt == bf16) {
+            const Zmm zmm_dst(dst.getIdx());
+            if (is_tail)
+                vpmovzxwd(zmm_dst | tail_opmask | T_z, src);
+            else
+                vpmovzxwd(zmm_dst, src);
+            vpslld(zmm_dst, zmm_dst, 16);
+        } else if (is_tail) {
+            load_tail(dst, src);
+        } else {
+            uni_vmovups(dst, src);
+        }
+    }
+
+    void store_data(data_type_t dt, const Address &dst, const Vmm &src,
+            bool is_tail) {
+        if (dt == bf16) {
+            const Zmm zmm_src(src.getIdx());
+            const Ymm ymm_src(src.getIdx());
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(ymm_src, zmm_src);
+            else
+                vcvtneps2bf16(ymm_src, zmm_src);
+            if (is_tail)
+                vmovdqu16(dst | tail_opmask, ymm_src);
+            else
+                vmovdqu16(dst, ymm_src);
+        } else if (is_tail) {
+            store_tail(dst, src);
+        } else {
+            uni_vmovups(dst, src);
+        }
+    }
+
+    void broadcast_src_value(const Address &src) {
+        if (wei_dt_ == bf16) {
+            vpbroadcastw(vreg_src_val, src);
+            vpslld(vreg_src_val, vreg_src_val, 16);
+        } else {
+            uni_vbroadcastss(vreg_src_val, src);
+        }
+    }
+
     void prepare_tail_mask();
 
     Vmm get_dst_reg(int index) const {
@@ -173,25 +300,28 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
     Vmm get_wei_reg(int index, bool is_tail_block) {
         // Vmm(0) is reserved for mask.
-        const int nloads = is_tail_block
-                ? utils::div_up(tail_block_size(), simd_w())
-                : block_size() / simd_w();
-        return Vmm(nloads + index + 1);
+        return Vmm(get_nloads(is_tail_block) + index + 1);
+    }
+
+    int get_nloads(bool is_tail_block) const {
+        return is_tail_block ? utils::div_up(tail_block_size(), simd_w())
+                             : block_size() / simd_w();
+    }
+
+    bool is_tail_load(int i_load, bool is_tail_block) const {
+        return is_tail_block && tail_size() > 0
+                && i_load == get_nloads(is_tail_block) - 1;
     }
 
     void loop_within_block_row(
             Vmm vreg_src_val, Reg64 reg_src_col_idx, bool is_tail_block) {
-        const int nloads = is_tail_block
-                ? utils::div_up(tail_block_size(), simd_w())
-                : block_size() / simd_w();
+        const int nloads = get_nloads(is_tail_block);
         for (int i_load = 0; i_load < nloads; i_load++) {
             Vmm vreg_tmp_wei = get_wei_reg(i_load, is_tail_block);
             // Load a row of weights.
-            if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                load_tail(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            } else {
-                uni_vmovups(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            }
+            load_data(wei_dt_, vreg_tmp_wei,
+                    wei_ptr(simd_w() * wei_type_size() * i_load),
+                    is_tail_load(i_load, is_tail_block));
             // Multiply the broadcasted value with the row of weights
             // and accumulate result in dst.
             Vmm vreg_tmp_dst = get_dst_reg(i_load);
@@ -209,8 +339,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
             for (int uf = 0; uf < unroll_factor; uf++) {
                 // Load src values to broadcast.
-                uni_vbroadcastss(
-                        vreg_src_val, src_values_ptr(uf * data_type_size()));
+                broadcast_src_value(src_values_ptr(uf * wei_type_size()));
                 // Load an index.
                 movsxd(reg_src_col_idx,
                         src_indices_ptr(uf * index_type_size()));
@@ -229,7 +358,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         jz(skip_row_tail, T_NEAR);
 
         // Load src values to broadcast.
-        uni_vbroadcastss(vreg_src_val, src_values_ptr());
+        broadcast_src_value(src_values_ptr());
         // Load an index.
         movsxd(reg_src_col_idx, src_indices_ptr());
         loop_within_block_row(vreg_src_val, reg_src_col_idx, is_tail_block);
@@ -237,6 +366,93 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         L(skip_row_tail);
     }
 
+    void apply_sum(bool is_tail_block) {
+        const int nloads = get_nloads(is_tail_block);
+        for (int i_load = 0; i_load < nloads; i_load++) {
+            const Vmm vreg_prev_dst = get_wei_reg(i_load, is_tail_block);
+            load_data(dst_dt_, vreg_prev_dst,
+                    dst_ptr(simd_w() * dst_type_size() * i_load),
+                    is_tail_load(i_load, is_tail_block));
+            const Vmm vreg_dst = get_dst_reg(i_load);
+            if (sum_scale_ == 1.f) {
+                uni_vaddps(vreg_dst, vreg_dst, vreg_prev_dst);
+            } else {
+                const Vmm vreg_sum_scale = vreg_src_val;
+                mov(reg_tmp.cvt32(), float2int(sum_scale_));
+                uni_vmovd(xreg_src_val, reg_tmp.cvt32());
+                uni_vbroadcastss(vreg_sum_scale, xreg_src_val);
+                uni_vfmadd231ps(vreg_dst, vreg_prev_dst, vreg_sum_scale);
+            }
+        }
+    }
+
+    // Applies scales, bias, post-ops and dst scales to the accumulated block.
+    void apply_epilogue(bool is_tail_block) {
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        const int nloads = get_nloads(is_tail_block);
+        // Weights registers are free once the block is accumulated.
+        const Vmm vreg_aux = get_wei_reg(0, is_tail_block);
+
+        if (with_scales_) {
+            if (!with_per_n_scales_) {
+                mov(reg_tmp, ptr[reg_param + PARAM_OFF(scales)]);
+                uni_vbroadcastss(vreg_aux, ptr[reg_tmp]);
+            }
+            for (int i_load = 0; i_load < nloads; i_load++) {
+                if (with_per_n_scales_)
+                    load_data(f32, vreg_aux,
+                            per_n_arg_ptr(PARAM_OFF(scales), sizeof(float),
+                                    simd_w() * sizeof(float) * i_load),
+                            is_tail_load(i_load, is_tail_block));
+                const Vmm vreg_dst = get_dst_reg(i_load);
+                uni_vmulps(vreg_dst, vreg_dst, vreg_aux);
+            }
+        }
+
+        if (bias_dt_ != undef) {
+            for (int i_load = 0; i_load < nloads; i_load++) {
+                load_data(bias_dt_, vreg_aux,
+                        per_n_arg_ptr(PARAM_OFF(bias), bias_type_size(),
+                                simd_w() * bias_type_size() * i_load),
+                        is_tail_load(i_load, is_tail_block));
+                const Vmm vreg_dst = get_dst_reg(i_load);
+                uni_vaddps(vreg_dst, vreg_dst, vreg_aux);
+            }
+        }
+
+        if (with_postops_) {
+            if (with_sum_) {
+                postops_injector_->set_lambda_injector(primitive_kind::sum,
+                        [this, is_tail_block]() { apply_sum(is_tail_block); });
+            }
+            binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+            if (with_binary_) {
+                // `reg_tmp` holds the address of the block in dst.
+                lea(reg_tmp, dst_ptr());
+                for (int i_load = 0; i_load < nloads; i_load++) {
+                    const int vmm_idx = get_dst_reg(i_load).getIdx();
+                    rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_idx, reg_tmp);
+                    rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                            vmm_idx, simd_w() * i_load);
+                    if (is_tail_load(i_load, is_tail_block))
+                        rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+                }
+            }
+            postops_injector_->compute_vector_range(get_dst_reg(0).getIdx(),
+                    get_dst_reg(nloads - 1).getIdx() + 1, rhs_arg_params);
+        }
+
+        if (with_dst_scales_) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(dst_scales)]);
+            uni_vbroadcastss(vreg_aux, ptr[reg_tmp]);
+            for (int i_load = 0; i_load < nloads; i_load++) {
+                const Vmm vreg_dst = get_dst_reg(i_load);
+                uni_vmulps(vreg_dst, vreg_dst, vreg_aux);
+            }
+        }
+#undef PARAM_OFF
+    }
+
     void loop_over_blocks(bool is_tail_block) {
         const size_t n_full_blocks = N() / block_size();
         const size_t nblocks = n_full_blocks + is_tail_block;
@@ -260,9 +476,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
             mov(reg_block_offset, reg_blocks_count);
             shl(reg_block_offset, math::ilog2q(block_size()));
 
-            const int nloads = is_tail_block
-                    ? utils::div_up(tail_block_size(), simd_w())
-                    : block_size() / simd_w();
+            const int nloads = get_nloads(is_tail_block);
             std::vector<Vmm> vregs_dst(nloads);
             for (int i_load = 0; i_load < nloads; i_load++) {
                 vregs_dst[i_load] = get_dst_reg(i_load);
@@ -271,13 +485,12 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
             }
 
             loop_within_block(unroll_factor(), is_tail_block);
+            apply_epilogue(is_tail_block);
 
             for (int i_load = 0; i_load < nloads; i_load++) {
-                if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                    store_tail(dst_ptr(vlen() * i_load), vregs_dst[i_load]);
-                } else {
-                    uni_vmovups(dst_ptr(vlen() * i_load), vregs_dst[i_load]);
-                }
+                store_data(dst_dt_,
+                        dst_ptr(simd_w() * dst_type_size() * i_load),
+                        vregs_dst[i_load], is_tail_load(i_load, is_tail_block));
             }
             add(reg_blocks_count, 1);
             jmp(loop_over_blocks_begin, T_NEAR);
@@ -294,13 +507,54 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     void generate() override {
         preamble();
         prepare_tail_mask();
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
         load_kernel_params();
         compute();
         postamble();
+
+        if (postops_injector_)
+            postops_injector_->prepare_table(/* generate = */ true);
+    }
+
+    void init_post_ops_injector(const matmul_pd_t *pd) {
+        const auto &post_ops = pd->attr()->post_ops_;
+        for (const auto &e : post_ops.entry_) {
+            if (e.is_sum(/* require_scale_one = */ false)) {
+                with_sum_ = true;
+                sum_scale_ = e.sum.scale;
+            }
+            with_binary_ = with_binary_ || e.is_binary();
+        }
+        with_postops_ = post_ops.len() > 0;
+        if (!with_postops_) return;
+
+        const memory_desc_wrapper dst_d(pd->dst_md());
+        const eltwise_injector::static_params_t esp(true /*save_state*/,
+                reg_po_helper_1, eltwise_opmask, true /*is_fwd*/,
+                false /*use_dst*/);
+        const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+                static_cast<size_t>(vreg_rhs_helper.getIdx()), reg_po_helper_1,
+                reg_po_helper_2, reg_po_helper_3, true /*preserve gpr*/,
+                true /*preserve vmm*/,
+                offsetof(call_params_t, post_ops_binary_rhs_arg_vec),
+                offsetof(call_params_t, dst_orig), dst_d, tail_size(),
+                tail_opmask, false /*use_exact_tail_scalar_bcast*/};
+        const binary_injector::static_params_t bsp(reg_param,
+                get_supported_postops_bcast_strategies(), rhs_arg_bsp);
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<isa, Vmm>>(
+                this, post_ops, bsp, esp);
     }
 
     jit_uni_sparse_matmul_kernel_t(const matmul_pd_t *pd)
-        : sparse_matmul_kernel_t(cpu_isa_traits_t<isa>::vlen, pd) {}
+        : sparse_matmul_kernel_t(cpu_isa_traits_t<isa>::vlen, pd) {
+        init_post_ops_injector(pd);
+        if (dst_dt_ == bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = utils::make_unique<bf16_emulation_t>(this,
+                    bf16_emu_reserv_1, bf16_emu_reserv_2, bf16_emu_reserv_3,
+                    reg_tmp, bf16_emu_reserv_4);
+    }
     ~jit_uni_sparse_matmul_kernel_t() override = default;
 };
 
@@ -346,13 +600,14 @@ jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
 jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
-    const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
-    const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    const auto *src_values = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
     const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
     const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
     status_t status = status::success;
-    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
     CHECK(status);
 
     const memory_desc_wrapper src_d(pd()->src_md());
@@ -361,6 +616,41 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
 
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const float *scales = precompute_scales(ctx.get_scratchpad_grantor(),
+            src_scales, wei_scales, N, pd()->attr());
+    const float dst_scale = 1.f / dst_scales[0];
+
+    const auto &post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    auto execute_row = [&](dim_t m) {
+        const int row_begin = src_pointers[m];
+        const int row_end = src_pointers[m + 1];
+        const int nnz = row_end - row_begin;
+
+        sparse_matmul_kernel_t::call_params_t p;
+        p.nnz = nnz;
+        p.src_values = src_values + row_begin * src_dt_size;
+        p.src_indices = src_indices + row_begin;
+        p.wei = weights;
+        p.bias = bias;
+        p.dst = dst + (m * N) * dst_dt_size;
+        p.scales = scales;
+        p.dst_scales = &dst_scale;
+        p.block_size = kernel_->block_size();
+        p.dst_orig = dst;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        (*kernel_)(&p);
+    };
+
     // TODO: Implement a load balancing mechanism that would distribute
     // rows between threads based on the number of non-zero elements in those
     // rows.
@@ -378,37 +668,11 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         balance211(M, nthr, ithr, start, end);
         if (start >= end) return;
 
-        for (dim_t m = start; m < end; m++) {
-            const int row_begin = src_pointers[m];
-            const int row_end = src_pointers[m + 1];
-            const int nnz = row_end - row_begin;
-
-            sparse_matmul_kernel_t::call_params_t p;
-            p.nnz = nnz;
-            p.src_values = src_values + row_begin;
-            p.src_indices = src_indices + row_begin;
-            p.wei = weights;
-            p.dst = dst + (m * N);
-            p.block_size = kernel_->block_size();
-            (*kernel_)(&p);
-        }
+        for (dim_t m = start; m < end; m++)
+            execute_row(m);
     });
 #else
-
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
-
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
-    });
+    parallel_nd(M, execute_row);
 #endif
     return status::success;
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023-2025 Intel Corporation
+* Copyright 2023-2026 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 
 #include "cpu/platform.hpp"
 #include "cpu/primitive_attr_postops.hpp"
+#include "cpu/scale_utils.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
@@ -43,6 +44,7 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
             const auto src_type = src_md(0)->data_type;
             const auto wei_type = weights_md(0)->data_type;
             const auto dst_type = dst_md(0)->data_type;
@@ -50,19 +52,38 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
 
+            // Sparse values and dense weights share the data type, the
+            // accumulation is always done in f32.
             const bool problem_dt_correct
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
+                    = utils::one_of(wei_type, f32, bf16) && src_type == wei_type
+                    && utils::one_of(dst_type, f32, bf16)
                     && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
                     && utils::everyone_is(s32, src_d.metadata_type(0),
                             src_d.metadata_type(1));
+            const bool with_bf16 = utils::one_of(bf16, wei_type, dst_type,
+                    with_bias() ? weights_md(1)->data_type : f32);
 
             VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
-            VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
-            VDISPATCH_MATMUL(
-                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(IMPLICATION(with_bias(),
+                                     utils::one_of(weights_md(1)->data_type,
+                                             f32, bf16)
+                                             && is_bias_1xN()),
+                    VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_MATMUL(attr()->has_default_values(
+                                     smask_t::scales | smask_t::post_ops),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_MATMUL(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+            VDISPATCH_MATMUL(IMPLICATION(with_bf16, mayiuse(avx512_core)),
+                    VERBOSE_UNSUPPORTED_ISA);
             VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_MATMUL(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+            init_scratchpad();
 
             return status::success;
         }
@@ -73,7 +94,34 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
                             format_tag::ab);
             const bool is_wei_ab = memory_desc_wrapper(weights_md())
                                            .matches_one_of_tag(format_tag::ab);
-            return is_dst_ab && is_wei_ab;
+            const bool is_bia_ab = IMPLICATION(with_bias(),
+                    memory_desc_wrapper(weights_md(1))
+                            .matches_one_of_tag(format_tag::ab));
+            return is_dst_ab && is_wei_ab && is_bia_ab;
+        }
+
+        // Common f32 scales, weights scales may also be per N.
+        bool scales_ok() const {
+            const auto &scales = attr()->scales_;
+            for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
+                if (scales.has_default_values(arg)) continue;
+                const int mask = scales.get_mask(arg);
+                const bool mask_ok = arg == DNNL_ARG_WEIGHTS
+                        ? utils::one_of(mask, 0, wei_qmask_N())
+                        : mask == 0;
+                if (!(mask_ok && scales.get_data_type(arg) == data_type::f32
+                            && scales.get(arg).has_default_groups()))
+                    return false;
+            }
+            return true;
+        }
+
+        bool post_ops_ok() const;
+
+    private:
+        void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            book_precomputed_scales(scratchpad, attr()->scales_, N());
         }
     };
 
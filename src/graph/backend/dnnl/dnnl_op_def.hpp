@@ -805,6 +805,39 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_gen_index, 1,
                         executable_creator<genindex_executable_t>)
                 .SET_ARG_INDICES_GETTER(genindex_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_paged_cache_load, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "cache")
+                .set_input(1, "block_table")
+                .set_output(0, "output")
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_paged_cache_load_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_paged_cache_load)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<paged_cache_load_executable_t>)
+                .SET_ARG_INDICES_GETTER(paged_cache_load_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_rope, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(2)
+                .set_input(0, "input")
+                .set_input(1, "cos")
+                .set_input(2, "sin")
+                .set_output(0, "output")
+                .set_output(1, "scratchpad")
+                // Attributes inherited from front RoPE ops
+                .set_attr(op_attr::mode, false, attribute_kind::s,
+                        "rotate_half", {"rotate_half", "interleaved"})
+                // Analysis rules
+                .set_shape_inference_function(infer_rope_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_rope)
+                .SET_EXECUTABLE_CREATOR(executable_creator<rope_executable_t>)
+                .SET_ARG_INDICES_GETTER(rope_executable_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_shuffle, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -1055,6 +1088,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
                         (int64_t)-1)
                 // New added attributes
+                .set_attr(op_attr::is_rms_norm, false, attribute_kind::b,
+                        false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_norm_output_shape)
@@ -80,6 +80,8 @@ namespace op_kind {
     X(dnnl_groupnorm, Dnnl_groupnorm) \
     X(dnnl_gen_index, Dnnl_gen_index) \
     X(dnnl_mask, Dnnl_mask) \
+    X(dnnl_paged_cache_load, Dnnl_paged_cache_load) \
+    X(dnnl_rope, Dnnl_rope) \
     X(dnnl_sdpa, Dnnl_sdpa) \
     X(dnnl_host_scalar, Dnnl_host_scalar)
 
@@ -0,0 +1,515 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "graph/backend/dnnl/kernels/gated_mlp_fused.hpp"
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/passes/lower.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#include "common/dnnl_thread.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+// Block sizes of the rows and of the intermediate dimension. The gate and up
+// weight tiles of a block ([K, i_blk] each) are reused for all the row blocks
+// of a thread, so i_blk is kept small enough for them to stay in L2.
+constexpr dim_t gated_mlp_m_blk = 32;
+constexpr dim_t gated_mlp_i_blk = 64;
+// Above this number of rows the weights are reused enough for the primitive
+// based implementation with reordered weights to be faster.
+constexpr dim_t gated_mlp_max_m = 256;
+
+// C[M, N] (+)= A[M, K] x B[K, N] for row-major f32 matrices.
+void ref_gemm(dim_t M, dim_t N, dim_t K, const float *A, dim_t lda,
+        const float *B, dim_t ldb, float *C, dim_t ldc, bool accumulate) {
+    for (dim_t m = 0; m < M; m++) {
+        float *c = C + m * ldc;
+        if (!accumulate) std::fill(c, c + N, 0.f);
+        for (dim_t k = 0; k < K; k++) {
+            const float a = A[m * lda + k];
+            const float *b = B + k * ldb;
+            PRAGMA_OMP_SIMD()
+            for (dim_t n = 0; n < N; n++)
+                c[n] += a * b[n];
+        }
+    }
+}
+
+bool is_dense_row_major(const logical_tensor_t &lt) {
+    const auto w = ltw(lt);
+    return w.is_strided() && w.vstrides() == get_dense_strides(w.vdims());
+}
+
+// Returns the leading dimension of a 2D row-major matrix, or 0 if the rows
+// are not contiguous. The rows may be padded, e.g. when the gate and the up
+// weights are slices of a combined weight tensor.
+dim_t get_row_major_ld(const logical_tensor_t &lt) {
+    const auto w = ltw(lt);
+    if (!w.is_strided() || w.ndims() != 2) return 0;
+    const auto dims = w.vdims();
+    const auto strides = w.vstrides();
+    if (strides[1] != 1 && dims[1] != 1) return 0;
+    return strides[0] >= dims[1] ? strides[0] : 0;
+}
+
+// An operand of the gating binary op: the output of a matmul with an optional
+// activation on it.
+struct gated_operand_t {
+    const op_t *mm = nullptr;
+    alg_kind_t act_alg = alg_kind::undef;
+    float alpha = 0.f, beta = 0.f;
+};
+
+// Matches `mm`, `eltwise(mm)` and `mm * logistic(mm)` (swish) on the value.
+bool match_gated_operand(const value_t &val, gated_operand_t &opd) {
+    if (!val.has_producer()) return false;
+    const op_t &op = val.get_producer();
+    const auto producer_of = [](const op_t &op, size_t idx) -> const op_t * {
+        const auto in = op.get_input_value(idx);
+        return in->has_producer() ? &in->get_producer() : nullptr;
+    };
+
+    if (op.get_kind() == op_kind::dnnl_matmul) {
+        opd.mm = &op;
+        return true;
+    }
+    if (op.get_kind() == op_kind::dnnl_eltwise) {
+        const op_t *mm = producer_of(op, 0);
+        if (!mm || mm->get_kind() != op_kind::dnnl_matmul) return false;
+        opd.mm = mm;
+        opd.act_alg = static_cast<alg_kind_t>(
+                op.get_attr<int64_t>(op_attr::alg_kind));
+        opd.alpha = op.get_attr<float>(op_attr::alpha);
+        opd.beta = op.get_attr<float>(op_attr::beta);
+        return true;
+    }
+    if (op.get_kind() == op_kind::dnnl_binary
+            && static_cast<alg_kind_t>(op.get_attr<int64_t>(op_attr::alg_kind))
+                    == alg_kind::binary_mul) {
+        for (size_t i = 0; i < 2; i++) {
+            const op_t *mm = producer_of(op, i);
+            const op_t *sig = producer_of(op, 1 - i);
+            if (!mm || !sig || mm->get_kind() != op_kind::dnnl_matmul
+                    || sig->get_kind() != op_kind::dnnl_eltwise
+                    || static_cast<alg_kind_t>(
+                               sig->get_attr<int64_t>(op_attr::alg_kind))
+                            != alg_kind::eltwise_logistic
+                    || producer_of(*sig, 0) != mm)
+                continue;
+            opd.mm = mm;
+            opd.act_alg = alg_kind::eltwise_swish;
+            opd.alpha = 1.f;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the offset of the partition input with the id of the value, or -1.
+int find_input(
+        const std::vector<logical_tensor_t> &inputs, const value_t &val) {
+    const size_t id = val.get_logical_tensor().id;
+    for (size_t i = 0; i < inputs.size(); i++)
+        if (inputs[i].id == id) return static_cast<int>(i);
+    return -1;
+}
+} // namespace
+
+status_t gated_mlp_fused_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    // get subgraph from the deep copied partition
+    subgraph_ = std::make_shared<subgraph_t>(
+            part->get_ops(), p_engine_, part->get_fpmath_mode(), false, true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+
+    subgraph_visualizer_t vis(part->id());
+    pass_pipeline_t pipeline = pass_pipeline_t(vis);
+    BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
+    BACKEND_DNNL_CHECK(pipeline.run(subgraph_));
+
+    CHECK(init_conf(subgraph_->ins_, subgraph_->outs_));
+
+    // fill information for inputs logical tensors
+    for (size_t i = 0; i < inputs.size(); i++) {
+        auto &in = const_cast<logical_tensor_t &>(inputs[i]);
+        in = subgraph_->ins_[i];
+    }
+
+    // fill information for outputs logical tensors. The output is always
+    // written as a dense row-major tensor.
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto &out = const_cast<logical_tensor_t &>(outputs[i]);
+        out = subgraph_->outs_[i];
+        if (ltw(out).is_any()) {
+            const dims strides = get_dense_strides(ltw(out).vdims());
+            out.layout_type = layout_type::strided;
+            for (size_t d = 0; d < strides.size(); d++)
+                out.layout.strides[d] = strides[d];
+        }
+    }
+
+    m_blk_ = std::min(gated_mlp_m_blk, M_);
+    i_blk_ = std::min(gated_mlp_i_blk, I_);
+
+#if DNNL_X64
+    using namespace cpu::x64;
+    if (mayiuse(avx2)) {
+        const dim_t M_tail = M_ % m_blk_;
+        const dim_t I_tail = I_ % i_blk_;
+        for_(int i_M = 0; i_M < 2; i_M++)
+        for (int i_I = 0; i_I < 2; i_I++) {
+            const dim_t M = i_M ? M_tail : m_blk_;
+            const dim_t I = i_I ? I_tail : i_blk_;
+            if (M == 0 || I == 0) continue;
+            // G[M, I] = src[M, K] x W_gate[K, I], same for the up projection
+            CHECK(create_brgemm(brg_gate_up_[i_M][i_I], M, I, K_, K_,
+                    ld_gate_up_, i_blk_, 0.f));
+            // dst[M, N] += H[M, I] x W_down[I, N]
+            CHECK(create_brgemm(
+                    brg_down_[i_M][i_I], M, N_, I, i_blk_, ld_down_, N_, 1.f));
+        }
+    }
+#endif
+    return status::success;
+}
+
+status_t gated_mlp_fused_kernel_t::init_conf(
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    if (outputs.size() != 1) return status::unimplemented;
+
+    // The subgraph is expected to contain the three matmuls, the gating
+    // binary op and the ops of the activation only.
+    const op_t *mm_down = nullptr;
+    size_t n_mm = 0;
+    for (const auto &op : subgraph_->get_ops()) {
+        const auto kind = op->get_kind();
+        if (kind == op_kind::dnnl_matmul) {
+            n_mm++;
+            const auto src = op->get_input_value(0);
+            if (src->has_producer()
+                    && src->get_producer().get_kind() == op_kind::dnnl_binary)
+                mm_down = op.get();
+        } else if (kind != op_kind::dnnl_eltwise
+                && kind != op_kind::dnnl_binary) {
+            return status::unimplemented;
+        }
+    }
+    if (n_mm != 3 || !mm_down) return status::unimplemented;
+
+    const op_t &bin = mm_down->get_input_value(0)->get_producer();
+    gated_operand_t opd[2];
+    for (size_t i = 0; i < 2; i++)
+        if (!match_gated_operand(*bin.get_input_value(i), opd[i]))
+            return status::unimplemented;
+    // The activation, if any, tells which side is the gate.
+    if (opd[0].act_alg != alg_kind::undef && opd[1].act_alg != alg_kind::undef)
+        return status::unimplemented;
+    gate_first_ = opd[1].act_alg == alg_kind::undef;
+    const gated_operand_t &gate = opd[gate_first_ ? 0 : 1];
+    const gated_operand_t &up = opd[gate_first_ ? 1 : 0];
+    act_alg_ = gate.act_alg;
+    act_alpha_ = gate.alpha;
+    act_beta_ = gate.beta;
+    bin_alg_ = static_cast<alg_kind_t>(
+            bin.get_attr<int64_t>(op_attr::alg_kind));
+
+    // Both projections read the same activation and nothing is fused into
+    // the matmuls.
+    const op_t *mms[3] = {gate.mm, up.mm, mm_down};
+    for (const op_t *mm : mms) {
+        if (mm->num_inputs() != 2) return status::unimplemented;
+        if (mm->has_attr(op_attr::transpose_a)
+                && mm->get_attr<bool>(op_attr::transpose_a))
+            return status::unimplemented;
+        if (mm->has_attr(op_attr::transpose_b)
+                && mm->get_attr<bool>(op_attr::transpose_b))
+            return status::unimplemented;
+    }
+    if (gate.mm->get_input_value(0).get() != up.mm->get_input_value(0).get())
+        return status::unimplemented;
+
+    src_idx_ = find_input(inputs, *gate.mm->get_input_value(0));
+    wei_gate_idx_ = find_input(inputs, *gate.mm->get_input_value(1));
+    wei_up_idx_ = find_input(inputs, *up.mm->get_input_value(1));
+    wei_down_idx_ = find_input(inputs, *mm_down->get_input_value(1));
+    if (src_idx_ < 0 || wei_gate_idx_ < 0 || wei_up_idx_ < 0
+            || wei_down_idx_ < 0)
+        return status::unimplemented;
+
+    const auto &src = inputs[src_idx_];
+    const auto &wei_gate = inputs[wei_gate_idx_];
+    const auto &wei_up = inputs[wei_up_idx_];
+    const auto &wei_down = inputs[wei_down_idx_];
+    const auto &dst = outputs[0];
+    for (const auto *lt : {&src, &wei_gate, &wei_up, &wei_down, &dst})
+        if (ltw(*lt).data_type() != data_type::f32)
+            return status::unimplemented;
+    if (!is_dense_row_major(src)) return status::unimplemented;
+    if (!ltw(dst).is_any() && !is_dense_row_major(dst))
+        return status::unimplemented;
+
+    const dims src_dims = ltw(src).vdims();
+    const dims dst_dims = ltw(dst).vdims();
+    if (src_dims.size() < 2 || dst_dims.size() != src_dims.size()
+            || ltw(wei_gate).ndims() != 2 || ltw(wei_down).ndims() != 2
+            || ltw(wei_up).vdims() != ltw(wei_gate).vdims())
+        return status::unimplemented;
+
+    K_ = src_dims.back();
+    I_ = ltw(wei_gate).dims()[1];
+    N_ = ltw(wei_down).dims()[1];
+    M_ = 1;
+    for (size_t d = 0; d + 1 < src_dims.size(); d++) {
+        if (dst_dims[d] != src_dims[d]) return status::unimplemented;
+        M_ *= src_dims[d];
+    }
+    if (ltw(wei_gate).dims()[0] != K_ || ltw(wei_down).dims()[0] != I_
+            || dst_dims.back() != N_)
+        return status::unimplemented;
+
+    // The gate and the up projections share the brgemm kernels, so their
+    // weights need the same leading dimension.
+    ld_gate_up_ = get_row_major_ld(wei_gate);
+    ld_down_ = get_row_major_ld(wei_down);
+    if (ld_gate_up_ == 0 || ld_down_ == 0
+            || get_row_major_ld(wei_up) != ld_gate_up_)
+        return status::unimplemented;
+    if (M_ == 0 || K_ == 0 || I_ == 0 || N_ == 0 || M_ > gated_mlp_max_m)
+        return status::unimplemented;
+
+    return status::success;
+}
+
+#if DNNL_X64
+status_t gated_mlp_fused_kernel_t::create_brgemm(
+        std::unique_ptr<cpu::x64::brgemm_kernel_t> &ker, dim_t M, dim_t N,
+        dim_t K, dim_t lda, dim_t ldb, dim_t ldc, float beta) {
+    using namespace cpu::x64;
+    const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    brgemm_desc_t desc;
+    CHECK(brgemm_desc_init(&desc, isa, brgemm_addr, impl::data_type::f32,
+            impl::data_type::f32, false, false, brgemm_row_major, 1.f, beta,
+            lda, ldb, ldc, M, N, K));
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    CHECK(brgemm_desc_set_attr(&desc, brgattr));
+    CHECK(brgemm_desc_finalize(&desc));
+
+    brgemm_kernel_t *brg_kernel = nullptr;
+    CHECK(brgemm_kernel_create(&brg_kernel, desc));
+    CHECK(safe_ptr_assign(ker, brg_kernel));
+    return status::success;
+}
+#endif
+
+void gated_mlp_fused_kernel_t::get_thread_grid(
+        int nthr, int &nthr_m, int &nthr_i) const {
+    const dim_t nb_m = impl::utils::div_up(M_, m_blk_);
+    const dim_t nb_i = impl::utils::div_up(I_, i_blk_);
+    nthr_m = static_cast<int>(std::min<dim_t>(nthr, nb_m));
+    nthr_i = static_cast<int>(std::max<dim_t>(
+            1, std::min<dim_t>(nthr / nthr_m, nb_i)));
+}
+
+status_t gated_mlp_fused_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    const float *src_ptr
+            = static_cast<const float *>(inputs[src_idx_].get_data_handle());
+    const float *wei_gate_ptr = static_cast<const float *>(
+            inputs[wei_gate_idx_].get_data_handle());
+    const float *wei_up_ptr
+            = static_cast<const float *>(inputs[wei_up_idx_].get_data_handle());
+    const float *wei_down_ptr = static_cast<const float *>(
+            inputs[wei_down_idx_].get_data_handle());
+    float *dst_ptr = static_cast<float *>(outputs[0].get_data_handle());
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+#else
+    UNUSED(g_stream);
+#endif
+
+    int nthr_m = 1, nthr_i = 1;
+    get_thread_grid(dnnl_get_max_threads(), nthr_m, nthr_i);
+    const int nthr = nthr_m * nthr_i;
+
+    // Each thread owns a gate and an up tile. The groups of threads working
+    // on the intermediate blocks other than the first one accumulate into
+    // their own copy of dst.
+    const size_t thr_buf_size = 2 * m_blk_ * i_blk_;
+    const size_t partial_size = M_ * N_;
+    const size_t buf_size
+            = thr_buf_size * nthr + partial_size * (nthr_i - 1);
+    temporary_scratchpad_t scratchpad(
+            buf_size * sizeof(float), p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= buf_size * sizeof(float),
+            "no enough scratchpad memory");
+    float *const thr_bufs = reinterpret_cast<float *>(scratchpad.get_buffer());
+    float *const partials = thr_bufs + thr_buf_size * nthr;
+
+    const auto gemm_gate_up = [&](dim_t M, dim_t I, const float *A,
+                                      const float *B, float *C) {
+#if DNNL_X64
+        const auto &ker = brg_gate_up_[M != m_blk_][I != i_blk_];
+        if (ker) {
+            cpu::x64::brgemm_batch_element_t batch;
+            batch.ptr.A = A;
+            batch.ptr.B = B;
+            cpu::x64::brgemm_kernel_execute(ker.get(), 1, &batch, C);
+            return;
+        }
+#endif
+        ref_gemm(M, I, K_, A, K_, B, ld_gate_up_, C, i_blk_, false);
+    };
+    const auto gemm_down = [&](dim_t M, dim_t I, const float *A,
+                                   const float *B, float *C) {
+#if DNNL_X64
+        const auto &ker = brg_down_[M != m_blk_][I != i_blk_];
+        if (ker) {
+            cpu::x64::brgemm_batch_element_t batch;
+            batch.ptr.A = A;
+            batch.ptr.B = B;
+            cpu::x64::brgemm_kernel_execute(ker.get(), 1, &batch, C);
+            return;
+        }
+#endif
+        ref_gemm(M, N_, I, A, i_blk_, B, ld_down_, C, N_, true);
+    };
+
+    const dim_t nb_m = impl::utils::div_up(M_, m_blk_);
+    const dim_t nb_i = impl::utils::div_up(I_, i_blk_);
+    const bool is_swish_mul = act_alg_ == alg_kind::eltwise_swish
+            && act_alpha_ == 1.f && bin_alg_ == alg_kind::binary_mul;
+
+    // Each (ithr_m, ithr_i) cell of the grid must run, including the zeroing
+    // of its rows of dst or of a partial copy, even if parallel() starts
+    // fewer threads than requested, e.g. inside an application parallel
+    // region.
+    const auto work = [&](const int ithr) {
+        const int ithr_m = ithr % nthr_m, ithr_i = ithr / nthr_m;
+        dim_t mb_start {0}, mb_end {0}, ib_start {0}, ib_end {0};
+        balance211(nb_m, nthr_m, ithr_m, mb_start, mb_end);
+        balance211(nb_i, nthr_i, ithr_i, ib_start, ib_end);
+        if (mb_start == mb_end) return;
+
+        const dim_t m_start = mb_start * m_blk_;
+        const dim_t m_end = std::min(M_, mb_end * m_blk_);
+        float *acc = ithr_i == 0 ? dst_ptr
+                                 : partials + (ithr_i - 1) * partial_size;
+        std::fill(acc + m_start * N_, acc + m_end * N_, 0.f);
+        if (ib_start == ib_end) return;
+
+        float *g_tile = thr_bufs + ithr * thr_buf_size;
+        float *u_tile = g_tile + m_blk_ * i_blk_;
+
+        for_(dim_t ib = ib_start; ib < ib_end; ib++)
+        for (dim_t mb = mb_start; mb < mb_end; mb++) {
+            const dim_t i_start = ib * i_blk_;
+            const dim_t I = std::min(i_blk_, I_ - i_start);
+            const dim_t m0 = mb * m_blk_;
+            const dim_t M = std::min(m_blk_, M_ - m0);
+            const float *src = src_ptr + m0 * K_;
+
+            gemm_gate_up(M, I, src, wei_gate_ptr + i_start, g_tile);
+            gemm_gate_up(M, I, src, wei_up_ptr + i_start, u_tile);
+
+            // H = act(G) op U, written over G.
+            for (dim_t m = 0; m < M; m++) {
+                float *g = g_tile + m * i_blk_;
+                const float *u = u_tile + m * i_blk_;
+                if (is_swish_mul) {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t i = 0; i < I; i++)
+                        g[i] = g[i] / (1.f + ::expf(-g[i])) * u[i];
+                    continue;
+                }
+                for (dim_t i = 0; i < I; i++) {
+                    const float a = act_alg_ == alg_kind::undef
+                            ? g[i]
+                            : cpu::compute_eltwise_scalar_fwd(
+                                    act_alg_, g[i], act_alpha_, act_beta_);
+                    g[i] = gate_first_
+                            ? cpu::compute_binary_scalar(
+                                    bin_alg_, a, u[i], false)
+                            : cpu::compute_binary_scalar(
+                                    bin_alg_, u[i], a, false);
+                }
+            }
+
+            gemm_down(M, I, g_tile, wei_down_ptr + i_start * ld_down_,
+                    acc + m0 * N_);
+        }
+    };
+
+    parallel(nthr, [&](const int ithr, const int nthr_started) {
+        for (int cell = ithr; cell < nthr; cell += nthr_started)
+            work(cell);
+    });
+
+    if (nthr_i > 1) {
+        parallel(0, [&](const int ithr, const int nthr_started) {
+            dim_t start {0}, end {0};
+            balance211(static_cast<dim_t>(partial_size), nthr_started, ithr,
+                    start, end);
+            for (int p = 0; p < nthr_i - 1; p++) {
+                const float *part = partials + p * partial_size;
+                PRAGMA_OMP_SIMD()
+                for (dim_t e = start; e < end; e++)
+                    dst_ptr[e] += part[e];
+            }
+        });
+    }
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_FUSED_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_FUSED_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/x64/brgemm/brgemm.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Single kernel for float gated MLP on CPU:
+//   dst = (act(src x W_gate) op (src x W_up)) x W_down
+//
+// The intermediate dimension is split in blocks. For a block of src rows and
+// a block of the intermediate dimension, the gate and up tiles are computed
+// with brgemm kernels over the same src tile, the activation and the gating
+// binary op are applied on the tiles while they are hot in cache, and the
+// result is immediately multiplied by the matching rows of W_down and
+// accumulated into dst. The [M, intermediate] tensors are never written to
+// memory.
+//
+// When there are not enough rows to keep all the threads busy (e.g. the
+// decoding phase of LLMs), the intermediate dimension is also split across
+// threads. Each group of threads accumulates into its own copy of dst and the
+// copies are summed up at the end, so every weight is read once per call.
+struct gated_mlp_fused_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    // Offsets of src, W_gate, W_up and W_down in the partition inputs.
+    int src_idx_ = -1, wei_gate_idx_ = -1, wei_up_idx_ = -1,
+        wei_down_idx_ = -1;
+
+    // Activation applied to the gate: eltwise algorithm with its alpha and
+    // beta, or alg_kind::undef if there is none.
+    alg_kind_t act_alg_ = alg_kind::undef;
+    float act_alpha_ = 0.f, act_beta_ = 0.f;
+    // Binary op between the gate and the up projections and whether the gate
+    // is its first operand.
+    alg_kind_t bin_alg_ = alg_kind::undef;
+    bool gate_first_ = true;
+
+    // src: [M, K], W_gate and W_up: [K, I], W_down: [I, N], dst: [M, N].
+    dim_t M_ = 0, K_ = 0, I_ = 0, N_ = 0;
+    // Leading dimensions of the weights.
+    dim_t ld_gate_up_ = 0, ld_down_ = 0;
+    dim_t m_blk_ = 0, i_blk_ = 0;
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    // Kernels are indexed by [is_M_tail][is_I_tail]. When the kernels can't
+    // be generated, reference loops are used instead.
+    std::unique_ptr<cpu::x64::brgemm_kernel_t> brg_gate_up_[2][2];
+    std::unique_ptr<cpu::x64::brgemm_kernel_t> brg_down_[2][2];
+
+    status_t create_brgemm(std::unique_ptr<cpu::x64::brgemm_kernel_t> &ker,
+            dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, dim_t ldc,
+            float beta);
+#endif
+
+    // Records the ops and the shapes of the pattern. Returns unimplemented
+    // for the cases which are not supported by the kernel.
+    status_t init_conf(const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+
+    // Splits the threads between the rows and the intermediate dimension.
+    void get_thread_grid(int nthr, int &nthr_m, int &nthr_i) const;
+
+public:
+    gated_mlp_fused_kernel_t() = default;
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(gated_mlp_fused_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(gated_mlp_fused_kernel_t)
+    // The kernel doesn't hold any engine specific object.
+    status_t reset_engine(const engine_t *g_engine) override {
+        p_engine_ = make_dnnl_engine(*g_engine);
+        return status::success;
+    }
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -26,6 +26,7 @@
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/sdp_decomp.hpp"
+#include "graph/backend/dnnl/kernels/sdp_flash.hpp"
 #include "graph/backend/dnnl/kernels/sdp_primitive.hpp"
 #include "graph/backend/dnnl/kernels/sdp_primitive_v1.hpp"
 
@@ -53,10 +54,12 @@ public:
             const std::vector<logical_tensor_t> &outputs) override {
         const engine_kind_t ekind = g_engine->kind();
         bool enable_decomp = false;
+        bool enable_flash = false;
         bool enable_ukernel = false;
 
         if (ekind == engine_kind::cpu) {
             enable_decomp = enable_decomp_kernel();
+            enable_flash = enable_flash_kernel();
         } else if (ekind == engine_kind::gpu) {
             enable_ukernel = !force_primitive();
         } else {
@@ -79,6 +82,14 @@ public:
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        // Tiled kernel with online softmax. Supports float sdpa only.
+        if (ret != status::success && enable_flash && !quantized) {
+            kernel = std::make_shared<sdp_flash_kernel_t>();
+            ret = kernel->compile_impl(part, g_engine, inputs, outputs);
+        }
+#endif
+
         if (ret != status::success && enable_decomp) {
             kernel = std::make_shared<sdp_decomp_kernel_t<quantized, dt>>();
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
@@ -110,6 +121,15 @@ public:
 #endif
     }
 
+    // It is used to check if enable the flash attention kernel. The kernel is
+    // enabled by default on CPU unless the primitive based implementation is
+    // forced or the kernel is disabled by the internal env var.
+    bool enable_flash_kernel() const {
+        const int enable = graph::utils::getenv_int_internal(
+                "GRAPH_SDPA_ENABLE_FLASH", 1);
+        return enable > 0 && !force_primitive();
+    }
+
     // An internal env var is provided to force using primitive based SDPA
     // implementation and skipping ukernel based optimization on GPU or
     // decomposition based optimization on CPU. Currently it's for oneDNN debug
@@ -51,7 +51,10 @@ status_t sdp_decomp_kernel_t<quantized, dt>::compile_impl(
     BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
 
     // Check if it's supported by decomposition kernel
-    if (!sdp_cfg_.initial_check(subgraph_, inputs, outputs))
+    // Paged key and value and RoPE are only supported by the flash kernel.
+    if (!sdp_cfg_.initial_check(subgraph_, inputs, outputs)
+            || !sdp_cfg_.check_threads_ratio() || sdp_cfg_.has_paged_kv
+            || sdp_cfg_.has_rope)
         return status::unimplemented;
 
     subgraph_visualizer_t vis(part->id(), [this](const value_t *val) {
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <utility>
+
 #include "graph/backend/dnnl/kernels/sdp_decomp_config.hpp"
 #include "graph/interface/shape_infer.hpp"
 
@@ -49,6 +51,23 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
 
     dims wei1_user_dims = ltw(inputs[graph_inport[mm1_wei]]).vdims();
     dims wei2_user_dims = ltw(inputs[graph_inport[mm2_wei]]).vdims();
+    if (has_paged_kv) {
+        VCHECK_SDP_DECOMP(ndims == 4, false,
+                "Paged KV cache only supports 4D query, but got %ld",
+                static_cast<long int>(ndims));
+        VCHECK_SDP_DECOMP(wei1_user_dims[2] == wei2_user_dims[2], false,
+                "Key and value page size mismatch, key: %ld, value: %ld",
+                static_cast<long int>(wei1_user_dims[2]),
+                static_cast<long int>(wei2_user_dims[2]));
+        page_size = wei1_user_dims[2];
+        // The batch size of paged key and value is given by the block tables.
+        wei1_user_dims[0] = ltw(inputs[graph_inport[k_block_table]]).vdims()[0];
+        wei2_user_dims[0] = ltw(inputs[graph_inport[v_block_table]]).vdims()[0];
+    }
+    if (has_rope) {
+        VCHECK_SDP_DECOMP(ndims == 4 && !has_paged_kv, false,
+                "RoPE only supports 4D contiguous query and key");
+    }
     num_head_kv = wei1_user_dims[1];
     VCHECK_SDP_DECOMP(num_head_kv == wei2_user_dims[1], false,
             "kv head number mismatch, kv head number: %ld, wei1: %ld, wei2: "
@@ -91,6 +110,10 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
             "value:%s",
             dnnl_dt2str(ltw(inputs[graph_inport[mm1_wei]]).data_type()),
             dnnl_dt2str(ltw(inputs[graph_inport[mm2_wei]]).data_type()));
+    return true;
+}
+
+bool sdp_decomp_config_t::check_threads_ratio() {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
 // RATIO is an empirical value used to determine the numerical relationship
 // between batch_size, num_head_q and thread number to determine whether to use
@@ -115,6 +138,97 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
     return true;
 }
 
+impl::status_t sdp_decomp_config_t::construct_flash_params(
+        std::shared_ptr<subgraph_t> &sg,
+        const std::vector<logical_tensor_t> &inputs) {
+    CHECK(record_sdp_ops(sg, false));
+    VCHECK_SDP_DECOMP(sdp_op[1] != nullptr, status::unimplemented,
+            "Failed to find sdp ops");
+    VCHECK_SDP_DECOMP(!has_select && !has_soft_capping, status::unimplemented,
+            "Flash kernel does not support select and soft-capping");
+
+    const int last_dim = ndims - 1;
+    const auto &lt_wei = sdp_op[1]->get_input_value(1)->get_logical_tensor();
+    seq_len_kv = ltw(lt_wei).vdims()[last_dim];
+
+    // The kernel reads the user buffers directly and accumulates in f32.
+    const auto is_f32 = [](const logical_tensor_t &lt) {
+        return ltw(lt).data_type() == data_type::f32;
+    };
+    const auto &lt_out = sdp_op[4]->get_output_value(0)->get_logical_tensor();
+    VCHECK_SDP_DECOMP(is_f32(inputs[graph_inport[mm1_src]])
+                    && is_f32(inputs[graph_inport[mm1_wei]])
+                    && is_f32(inputs[graph_inport[mm2_wei]])
+                    && is_f32(sdp_op[1]->get_output_value(0)
+                                      ->get_logical_tensor())
+                    && is_f32(lt_out),
+            status::unimplemented, "Flash kernel only supports f32");
+    if (has_scale)
+        VCHECK_SDP_DECOMP(is_f32(inputs[graph_inport[mm1_scale]]),
+                status::unimplemented, "Flash kernel only supports f32 scale");
+    if (has_attention_mask)
+        VCHECK_SDP_DECOMP(is_f32(inputs[graph_inport[mm1_add]]),
+                status::unimplemented, "Flash kernel only supports f32 mask");
+    if (has_rope)
+        VCHECK_SDP_DECOMP(is_f32(inputs[graph_inport[q_cos]])
+                        && is_f32(inputs[graph_inport[q_sin]])
+                        && is_f32(inputs[graph_inport[k_cos]])
+                        && is_f32(inputs[graph_inport[k_sin]]),
+                status::unimplemented, "Flash kernel only supports f32 RoPE");
+
+    src1_strides = ltw(inputs[graph_inport[mm1_src]]).vstrides();
+    if (has_paged_kv) {
+        // Strides of the page pools and of the block tables.
+        wei1_strides = ltw(inputs[graph_inport[mm1_wei]]).vstrides();
+        wei2_strides = ltw(inputs[graph_inport[mm2_wei]]).vstrides();
+        k_table_strides = ltw(inputs[graph_inport[k_block_table]]).vstrides();
+        v_table_strides = ltw(inputs[graph_inport[v_block_table]]).vstrides();
+    } else if (has_rope) {
+        // mm1 reads the rotated key, so the [head_size_qk, seq_len_kv] view
+        // is taken on the user key which is transposed by mm1.
+        wei1_strides = ltw(inputs[graph_inport[mm1_wei]]).vstrides();
+        std::swap(wei1_strides[last_dim], wei1_strides[last_dim - 1]);
+        wei2_strides = ltw(inputs[graph_inport[mm2_wei]]).vstrides();
+    } else {
+        // Strides of the key in the [head_size_qk, seq_len_kv] view used by
+        // mm1.
+        wei1_strides = make_dnnl_memory_desc(lt_wei).get_strides();
+        wei2_strides = ltw(inputs[graph_inport[mm2_wei]]).vstrides();
+    }
+    dst_strides = ltw(lt_out).vstrides();
+    VCHECK_SDP_DECOMP(lt_out.id == sg->outs_[0].id,
+            status::unimplemented,
+            "Flash kernel requires matmul2 to produce the partition output");
+
+    // The scale and the mask are fused into mm1 as binary post-ops in this
+    // order.
+    auto &mgr = sg->fusion_info_mgr_;
+    const auto mm1_pops = make_primitive_attr(sdp_op[1], mgr).get_post_ops();
+    int binary_idx = 0;
+    for (int i = 0; i < mm1_pops.get()->len(); i++) {
+        const auto &e = mm1_pops.get()->entry_[i];
+        VCHECK_SDP_DECOMP(e.is_binary(), status::unimplemented,
+                "Flash kernel only supports binary post-ops for matmul1");
+        const auto alg = e.binary.alg;
+        if (has_scale && binary_idx == 0) {
+            VCHECK_SDP_DECOMP(impl::utils::one_of(alg, alg_kind::binary_mul,
+                                      alg_kind::binary_div),
+                    status::unimplemented, "Unsupported scale algorithm");
+            is_scale_div = alg == alg_kind::binary_div;
+        } else {
+            VCHECK_SDP_DECOMP(alg == alg_kind::binary_add,
+                    status::unimplemented, "Unsupported mask algorithm");
+        }
+        binary_idx++;
+    }
+    VCHECK_SDP_DECOMP(binary_idx == (int)has_scale + (int)has_attention_mask,
+            status::unimplemented, "Unexpected post-ops for matmul1");
+
+    const auto mode = sdp_op[2]->get_attr<std::string>(op_attr::mode);
+    is_softmax_inf_as_zero = mode == "inf_as_zero";
+    return status::success;
+}
+
 template <bool quantized, memory::data_type dt>
 impl::status_t sdp_decomp_config_t::construct_params(
         std::shared_ptr<subgraph_t> &sg, registry_t &sdp_registry,
@@ -644,6 +758,77 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
         graph_inport.emplace_back(-1);
         graph_inport.emplace_back(-1);
     }
+
+    // for paged key and value, mm1_wei and mm2_wei above are the page pools.
+    const auto get_paged_load = [](const op_ptr &mm) -> op_t * {
+        auto val = mm->get_input_value(1);
+        if (!val->has_producer()) return nullptr;
+        auto &producer = val->get_producer();
+        return producer.get_kind() == graph::op_kind::PagedCacheLoad
+                ? &producer
+                : nullptr;
+    };
+    op_t *k_load = get_paged_load(mm1), *v_load = get_paged_load(mm2);
+    VCHECK_SDP_DECOMP((k_load == nullptr) == (v_load == nullptr),
+            status::unimplemented,
+            "Key and value should be both paged or both contiguous");
+    has_paged_kv = k_load != nullptr;
+    if (has_paged_kv) {
+        int k_table_id = find_graph_inport(k_load->get_input_value(1));
+        int v_table_id = find_graph_inport(v_load->get_input_value(1));
+        VCHECK_SDP_DECOMP(k_table_id != -1 && v_table_id != -1,
+                status::invalid_graph, "failed to find block table inport");
+        graph_inport.emplace_back(k_table_id);
+        graph_inport.emplace_back(v_table_id);
+    } else {
+        //placeholder
+        graph_inport.emplace_back(-1);
+        graph_inport.emplace_back(-1);
+    }
+
+    // for RoPE, mm1_src and mm1_wei above are the query and key before the
+    // rotation.
+    const auto get_rope = [](const op_ptr &mm, size_t offset) -> op_t * {
+        auto val = mm->get_input_value(offset);
+        if (!val->has_producer()) return nullptr;
+        auto &producer = val->get_producer();
+        return producer.get_kind() == graph::op_kind::RoPE ? &producer
+                                                           : nullptr;
+    };
+    op_t *q_rope = get_rope(mm1, 0), *k_rope = get_rope(mm1, 1);
+    VCHECK_SDP_DECOMP((q_rope == nullptr) == (k_rope == nullptr),
+            status::unimplemented,
+            "Query and key should be both rotated or both not rotated");
+    has_rope = q_rope != nullptr;
+    if (has_rope) {
+        const auto get_mode = [](const op_t *rope) {
+            return rope->has_attr(op_attr::mode)
+                    ? rope->get_attr<std::string>(op_attr::mode)
+                    : std::string("rotate_half");
+        };
+        VCHECK_SDP_DECOMP(get_mode(q_rope) == get_mode(k_rope),
+                status::unimplemented,
+                "Query and key should be rotated with the same mode");
+        // The key is rotated along the head size, so it must be transposed
+        // by mm1.
+        VCHECK_SDP_DECOMP(mm1->has_attr(op_attr::transpose_b)
+                        && mm1->get_attr<bool>(op_attr::transpose_b),
+                status::unimplemented,
+                "RoPE requires matmul 1 transpose_b to be true");
+        is_rope_interleaved = get_mode(q_rope) == "interleaved";
+        for (const op_t *rope : {q_rope, k_rope}) {
+            int cos_id = find_graph_inport(rope->get_input_value(1));
+            int sin_id = find_graph_inport(rope->get_input_value(2));
+            VCHECK_SDP_DECOMP(cos_id != -1 && sin_id != -1,
+                    status::invalid_graph, "failed to find cos/sin inport");
+            graph_inport.emplace_back(cos_id);
+            graph_inport.emplace_back(sin_id);
+        }
+    } else {
+        //placeholder
+        for (int i = 0; i < 4; i++)
+            graph_inport.emplace_back(-1);
+    }
     return status::success;
 }
 
@@ -93,7 +93,10 @@ public:
     int nthr;
 
     // Used to record the exact input offset in subgraph
-    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input]
+    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input,k_block_table,v_block_table,q_cos,q_sin,k_cos,k_sin]
+    // For a paged KV cache, mm1_wei and mm2_wei are the key and value page
+    // pools. With RoPE, mm1_src and mm1_wei are the query and key before the
+    // rotation.
     std::vector<int> graph_inport;
     enum input_index_t {
         mm1_src = 0,
@@ -103,7 +106,13 @@ public:
         mm1_soft_capping,
         mm1_add,
         select_condition,
-        select_other_input
+        select_other_input,
+        k_block_table,
+        v_block_table,
+        q_cos,
+        q_sin,
+        k_cos,
+        k_sin
     };
 
     // Primitives that actually perform calculations
@@ -145,6 +154,18 @@ public:
 
     bool has_scale = false, has_attention_mask = false, has_select = false,
          has_soft_capping = false;
+    // Used by the flash attention kernel which applies the scale, the mask
+    // and the softmax by itself instead of through primitives.
+    bool is_scale_div = false, is_softmax_inf_as_zero = false;
+    // Key and value are read from [num_blocks, num_head_kv, block_size,
+    // head_size] page pools through [batch_size, max_num_blocks] block tables
+    // (PagedCacheLoad ops). Only supported by the flash attention kernel.
+    bool has_paged_kv = false;
+    dim_t page_size = 0;
+    dims k_table_strides, v_table_strides;
+    // Query and key are rotated by RoPE ops before mm1. Only supported by the
+    // flash attention kernel which rotates the tiles while loading them.
+    bool has_rope = false, is_rope_interleaved = false;
     // Used to record the ops from select
     std::vector<op_ptr> select_op;
     std::vector<int> select_outop_index;
@@ -167,6 +188,10 @@ public:
             const std::vector<logical_tensor_t> &inputs,
             const std::vector<logical_tensor_t> &outputs);
 
+    // Checks if there is enough batch_size * num_head_q work to keep all the
+    // threads busy when each thread processes a whole head.
+    bool check_threads_ratio();
+
     // Used to construct all params that SDP need
     template <bool quantized = false,
             memory::data_type dt = memory::data_type::f32>
@@ -175,6 +200,12 @@ public:
             const std::vector<logical_tensor_t> &inputs);
     impl::status_t reset_engine(const dnnl::engine &p_engine);
 
+    // Used to construct the params of the flash attention kernel. Only the
+    // shapes, strides and post-op kinds are recorded, no primitive is
+    // created.
+    impl::status_t construct_flash_params(std::shared_ptr<subgraph_t> &sg,
+            const std::vector<logical_tensor_t> &inputs);
+
 private:
     op_ptr get_post_op(const op_ptr &op) const;
 
@@ -0,0 +1,652 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "graph/backend/dnnl/kernels/sdp_flash.hpp"
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+
+#include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/passes/insert_ops.hpp"
+#include "graph/backend/dnnl/passes/layout_propagation.hpp"
+#include "graph/backend/dnnl/passes/lower.hpp"
+#include "graph/backend/dnnl/passes/transform.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#include "common/dnnl_thread.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+// Block sizes of the query and key/value sequences. A query block of
+// q_blk rows and a key/value block of kv_blk rows keep the score tile, the
+// output accumulator and the key/value tiles within L2 for typical head
+// sizes.
+constexpr dim_t sdp_flash_q_blk = 64;
+constexpr dim_t sdp_flash_kv_blk = 128;
+// Minimal number of key/value blocks processed by a thread when the key/value
+// sequence is split across threads.
+constexpr dim_t sdp_flash_min_kv_blks = 2;
+
+// C[M, N] (+)= A[M, K] x B[K, N] for row-major f32 matrices.
+void ref_gemm(dim_t M, dim_t N, dim_t K, const float *A, dim_t lda,
+        const float *B, dim_t ldb, float *C, dim_t ldc, bool accumulate) {
+    for (dim_t m = 0; m < M; m++) {
+        float *c = C + m * ldc;
+        if (!accumulate) std::fill(c, c + N, 0.f);
+        for (dim_t k = 0; k < K; k++) {
+            const float a = A[m * lda + k];
+            const float *b = B + k * ldb;
+            PRAGMA_OMP_SIMD()
+            for (dim_t n = 0; n < N; n++)
+                c[n] += a * b[n];
+        }
+    }
+}
+} // namespace
+
+status_t sdp_flash_kernel_t::compile_impl(const dnnl_partition_impl_t *part,
+        const engine_t *g_engine, const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    // get subgraph from the deep copied partition
+    subgraph_ = std::make_shared<subgraph_t>(
+            part->get_ops(), p_engine_, part->get_fpmath_mode(), false, true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+
+    if (!sdp_cfg_.initial_check(subgraph_, inputs, outputs))
+        return status::unimplemented;
+
+    subgraph_visualizer_t vis(part->id());
+    pass_pipeline_t pipeline = pass_pipeline_t(vis);
+    BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_reshape_for_gqa);
+    BACKEND_DNNL_ADD_PASS(pipeline, binary_canonicalization);
+    BACKEND_DNNL_ADD_PASS(pipeline, sdp_fuse_post_ops);
+    BACKEND_DNNL_ADD_PASS(pipeline, insert_permute_for_matmul);
+    pipeline.reset_visualize_arg(true, false);
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_dst_transpose_to_predecessor);
+    BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
+
+    // Run the added passes
+    BACKEND_DNNL_CHECK(pipeline.run(subgraph_));
+
+    // fill information for inputs logical tensors
+    for (size_t i = 0; i < inputs.size(); i++) {
+        auto &in = const_cast<logical_tensor_t &>(inputs[i]);
+        in = subgraph_->ins_[i];
+    }
+
+    // fill information for outputs logical tensors
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto &out = const_cast<logical_tensor_t &>(outputs[i]);
+        out = subgraph_->outs_[i];
+    }
+
+    CHECK(sdp_cfg_.construct_flash_params(subgraph_, inputs));
+
+    const auto &cfg = sdp_cfg_;
+    const int last = static_cast<int>(cfg.ndims) - 1, second_last = last - 1;
+    q_blk_ = std::min(sdp_flash_q_blk, cfg.seq_len_q);
+    kv_splits_ = graph::utils::getenv_int_internal(
+            "GRAPH_SDPA_FLASH_KV_SPLITS", 0);
+    kv_blk_ = std::min(sdp_flash_kv_blk, cfg.seq_len_kv);
+
+    q_in_place_ = !cfg.has_rope && cfg.src1_strides[last] == 1;
+    // Paged key and value tiles are always gathered through the block tables.
+    k_in_place_ = !cfg.has_paged_kv && !cfg.has_rope
+            && cfg.wei1_strides[last] == 1;
+    v_in_place_ = !cfg.has_paged_kv && cfg.wei2_strides[last] == 1;
+    lda_q_ = q_in_place_ ? cfg.src1_strides[second_last] : cfg.head_size_qk;
+    ldb_k_ = k_in_place_ ? cfg.wei1_strides[second_last] : kv_blk_;
+    ldb_v_ = v_in_place_ ? cfg.wei2_strides[second_last] : cfg.head_size_v;
+
+#if DNNL_X64
+    using namespace cpu::x64;
+    if (mayiuse(avx2)) {
+        const dim_t M_tail = cfg.seq_len_q % q_blk_;
+        const dim_t kv_tail = cfg.seq_len_kv % kv_blk_;
+        for_(int i_M = 0; i_M < 2; i_M++)
+        for (int i_kv = 0; i_kv < 2; i_kv++) {
+            const dim_t M = i_M ? M_tail : q_blk_;
+            const dim_t kv = i_kv ? kv_tail : kv_blk_;
+            if (M == 0 || kv == 0) continue;
+            // S[M, kv] = Q[M, head_size_qk] x K^T[head_size_qk, kv]
+            CHECK(create_brgemm(brg_qk_[i_M][i_kv], M, kv, cfg.head_size_qk,
+                    lda_q_, ldb_k_, kv_blk_, 0.f));
+            // O[M, head_size_v] += P[M, kv] x V[kv, head_size_v]
+            CHECK(create_brgemm(brg_pv_[i_M][i_kv], M, cfg.head_size_v, kv,
+                    kv_blk_, ldb_v_, cfg.head_size_v, 1.f));
+        }
+    }
+#endif
+    return status::success;
+}
+
+#if DNNL_X64
+status_t sdp_flash_kernel_t::create_brgemm(
+        std::unique_ptr<cpu::x64::brgemm_kernel_t> &ker, dim_t M, dim_t N,
+        dim_t K, dim_t lda, dim_t ldb, dim_t ldc, float beta) {
+    using namespace cpu::x64;
+    const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    brgemm_desc_t desc;
+    CHECK(brgemm_desc_init(&desc, isa, brgemm_addr, impl::data_type::f32,
+            impl::data_type::f32, false, false, brgemm_row_major, 1.f, beta,
+            lda, ldb, ldc, M, N, K));
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    CHECK(brgemm_desc_set_attr(&desc, brgattr));
+    CHECK(brgemm_desc_finalize(&desc));
+
+    brgemm_kernel_t *brg_kernel = nullptr;
+    CHECK(brgemm_kernel_create(&brg_kernel, desc));
+    CHECK(safe_ptr_assign(ker, brg_kernel));
+    return status::success;
+}
+#endif
+
+dim_t sdp_flash_kernel_t::get_kv_splits(
+        int nthr, dim_t work_amount, dim_t nb_kv) const {
+    if (kv_splits_ > 0) return std::min<dim_t>(kv_splits_, nb_kv);
+    if (work_amount >= nthr) return 1;
+    // Keep at least sdp_flash_min_kv_blks key/value blocks per chunk so that
+    // the merge stays cheap compared to the chunks.
+    return std::max<dim_t>(1,
+            std::min<dim_t>(impl::utils::div_up(nthr, work_amount),
+                    nb_kv / sdp_flash_min_kv_blks));
+}
+
+size_t sdp_flash_kernel_t::thread_buffer_size() const {
+    const auto &cfg = sdp_cfg_;
+    size_t size = 0;
+    if (!q_in_place_) size += q_blk_ * cfg.head_size_qk; // Q tile
+    if (!k_in_place_) size += cfg.head_size_qk * kv_blk_; // K^T tile
+    if (!v_in_place_) size += kv_blk_ * cfg.head_size_v; // V tile
+    size += q_blk_ * kv_blk_; // scores and probabilities
+    size += q_blk_ * cfg.head_size_v; // output accumulator
+    size += 2 * q_blk_; // running row max and row sum
+    return size;
+}
+
+status_t sdp_flash_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    using input_index_t = sdp_decomp_config_t::input_index_t;
+    const auto &cfg = sdp_cfg_;
+    const auto get_input = [&](input_index_t idx) -> const tensor_t & {
+        return inputs[cfg.graph_inport[idx]];
+    };
+
+    const float *q_ptr = static_cast<const float *>(
+            get_input(sdp_decomp_config_t::mm1_src).get_data_handle());
+    const float *k_ptr = static_cast<const float *>(
+            get_input(sdp_decomp_config_t::mm1_wei).get_data_handle());
+    const float *v_ptr = static_cast<const float *>(
+            get_input(sdp_decomp_config_t::mm2_wei).get_data_handle());
+    float *dst_ptr = static_cast<float *>(outputs[0].get_data_handle());
+    const int32_t *k_table_ptr = nullptr, *v_table_ptr = nullptr;
+    if (cfg.has_paged_kv) {
+        k_table_ptr = static_cast<const int32_t *>(
+                get_input(sdp_decomp_config_t::k_block_table)
+                        .get_data_handle());
+        v_table_ptr = static_cast<const int32_t *>(
+                get_input(sdp_decomp_config_t::v_block_table)
+                        .get_data_handle());
+    }
+
+    float scale = 1.f;
+    if (cfg.has_scale) {
+        scale = *static_cast<const float *>(
+                get_input(sdp_decomp_config_t::mm1_scale).get_data_handle());
+        if (cfg.is_scale_div) scale = 1.f / scale;
+    }
+
+    // The mask is broadcast over the dimensions of size 1.
+    const float *mask_ptr = nullptr;
+    dims mask_dims, mask_strides;
+    dim_t mask_stride_q = 0, mask_stride_kv = 0;
+    if (cfg.has_attention_mask) {
+        const auto &mask = get_input(sdp_decomp_config_t::mm1_add);
+        mask_ptr = static_cast<const float *>(mask.get_data_handle());
+        mask_dims = ltw(mask.get_logical_tensor()).vdims();
+        mask_strides = ltw(mask.get_logical_tensor()).vstrides();
+        const size_t nd = mask_dims.size();
+        if (nd >= 1 && mask_dims[nd - 1] != 1)
+            mask_stride_kv = mask_strides[nd - 1];
+        if (nd >= 2 && mask_dims[nd - 2] != 1)
+            mask_stride_q = mask_strides[nd - 2];
+    }
+
+    // cos and sin of the query and of the key RoPE, broadcast to
+    // [batch, head, seq_len, head_size] over the dimensions of size 1.
+    const float *rope_ptrs[4] = {nullptr, nullptr, nullptr, nullptr};
+    dim_t rope_strides[4][4] = {};
+    if (cfg.has_rope) {
+        const input_index_t rope_idx[4] = {sdp_decomp_config_t::q_cos,
+                sdp_decomp_config_t::q_sin, sdp_decomp_config_t::k_cos,
+                sdp_decomp_config_t::k_sin};
+        for (int i = 0; i < 4; i++) {
+            const auto &t = get_input(rope_idx[i]);
+            rope_ptrs[i] = static_cast<const float *>(t.get_data_handle());
+            const dims t_dims = ltw(t.get_logical_tensor()).vdims();
+            const dims t_strides = ltw(t.get_logical_tensor()).vstrides();
+            const int off = 4 - static_cast<int>(t_dims.size());
+            for (int d = std::max(off, 0); d < 4; d++)
+                if (t_dims[d - off] != 1)
+                    rope_strides[i][d] = t_strides[d - off];
+        }
+    }
+
+    const int last = static_cast<int>(cfg.ndims) - 1, second_last = last - 1;
+    const dim_t B = cfg.batch_size, H = cfg.num_head_q;
+    const dim_t SQ = cfg.seq_len_q, SKV = cfg.seq_len_kv;
+    const dim_t HSQK = cfg.head_size_qk, HSV = cfg.head_size_v;
+    const dim_t group_head = cfg.num_head_q / cfg.num_head_kv;
+    const dim_t nb_q = impl::utils::div_up(SQ, q_blk_);
+    const dim_t nb_kv = impl::utils::div_up(SKV, kv_blk_);
+    const dim_t work_amount = B * H * nb_q;
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+#else
+    UNUSED(g_stream);
+#endif
+
+    // With few query blocks (e.g. decoding with a single query row), the
+    // key/value sequence is split into chunks processed by different threads.
+    // Each chunk produces an unnormalized output with its own row max and row
+    // sum, and the chunks are merged with a log-sum-exp reduction at the end.
+    // The split depends on the number of threads, so it is chosen once the
+    // threadpool of the stream is active.
+    const dim_t n_kv_splits
+            = get_kv_splits(dnnl_get_max_threads(), work_amount, nb_kv);
+    const dim_t split_work_amount = work_amount * n_kv_splits;
+    const int nthr = static_cast<int>(
+            std::min<dim_t>(dnnl_get_max_threads(), split_work_amount));
+    const size_t thr_buf_size = thread_buffer_size();
+    // Output accumulator, row max and row sum of every chunk.
+    const size_t part_size = q_blk_ * (HSV + 2);
+    const size_t parts_size
+            = n_kv_splits > 1 ? part_size * split_work_amount : 0;
+    const size_t buf_size = thr_buf_size * nthr + parts_size;
+    temporary_scratchpad_t scratchpad(
+            buf_size * sizeof(float), p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= buf_size * sizeof(float),
+            "no enough scratchpad memory");
+    float *const parts = reinterpret_cast<float *>(scratchpad.get_buffer())
+            + thr_buf_size * nthr;
+
+    const auto get_dst = [&](dim_t bo, dim_t bi, dim_t q_start) {
+        const dim_t kv_head = bi / group_head;
+        const dim_t group_id = bi % group_head;
+        const dim_t dst_head_off = cfg.ndims == 4
+                ? bi * cfg.dst_strides[1]
+                : kv_head * cfg.dst_strides[1] + group_id * cfg.dst_strides[2];
+        return dst_ptr + bo * cfg.dst_strides[0] + dst_head_off
+                + q_start * cfg.dst_strides[second_last];
+    };
+    // Normalizes the accumulated output of M rows by the row sums and writes
+    // it to dst.
+    const auto store_dst = [&](dim_t M, const float *o_acc,
+                                   const float *row_sum, float *dst) {
+        for (dim_t m = 0; m < M; m++) {
+            // A fully masked row has a zero sum. It yields NaN for the
+            // accurate softmax and zeros for the `inf_as_zero` mode.
+            const float inv_sum
+                    = row_sum[m] == 0.f && cfg.is_softmax_inf_as_zero
+                    ? 0.f
+                    : 1.f / row_sum[m];
+            const float *o = o_acc + m * HSV;
+            float *d_row = dst + m * cfg.dst_strides[second_last];
+            for (dim_t d = 0; d < HSV; d++)
+                d_row[d * cfg.dst_strides[last]] = o[d] * inv_sum;
+        }
+    };
+
+    // Rotates a query (which == 0) or key (which == 2) row of head_size_qk
+    // elements at position `pos` of the sequence.
+    const auto rotate_row = [&](int which, dim_t b, dim_t h, dim_t pos,
+                                    const float *src, dim_t src_stride,
+                                    float *dst, dim_t dst_stride) {
+        const dim_t *cs = rope_strides[which], *ss = rope_strides[which + 1];
+        const float *c
+                = rope_ptrs[which] + b * cs[0] + h * cs[1] + pos * cs[2];
+        const float *s
+                = rope_ptrs[which + 1] + b * ss[0] + h * ss[1] + pos * ss[2];
+        for (dim_t d = 0; d < HSQK; d++) {
+            float sign = 1.f;
+            const dim_t p = rope_executable_t::get_pair(
+                    d, HSQK, cfg.is_rope_interleaved, sign);
+            dst[d * dst_stride] = src[d * src_stride] * c[d * cs[3]]
+                    + sign * src[p * src_stride] * s[d * ss[3]];
+        }
+    };
+
+    const auto gemm_qk = [&](dim_t M, dim_t N, const float *A, const float *B,
+                                 float *C) {
+#if DNNL_X64
+        const auto &ker = brg_qk_[M != q_blk_][N != kv_blk_];
+        if (ker) {
+            cpu::x64::brgemm_batch_element_t batch;
+            batch.ptr.A = A;
+            batch.ptr.B = B;
+            cpu::x64::brgemm_kernel_execute(ker.get(), 1, &batch, C);
+            return;
+        }
+#endif
+        ref_gemm(M, N, HSQK, A, lda_q_, B, ldb_k_, C, kv_blk_, false);
+    };
+    const auto gemm_pv = [&](dim_t M, dim_t K, const float *A, const float *B,
+                                 float *C) {
+#if DNNL_X64
+        const auto &ker = brg_pv_[M != q_blk_][K != kv_blk_];
+        if (ker) {
+            cpu::x64::brgemm_batch_element_t batch;
+            batch.ptr.A = A;
+            batch.ptr.B = B;
+            cpu::x64::brgemm_kernel_execute(ker.get(), 1, &batch, C);
+            return;
+        }
+#endif
+        ref_gemm(M, HSV, K, A, kv_blk_, B, ldb_v_, C, HSV, true);
+    };
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(split_work_amount, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *buf = reinterpret_cast<float *>(scratchpad.get_buffer())
+                + ithr * thr_buf_size;
+        float *q_tile = nullptr, *k_tile = nullptr, *v_tile = nullptr;
+        if (!q_in_place_) {
+            q_tile = buf;
+            buf += q_blk_ * HSQK;
+        }
+        if (!k_in_place_) {
+            k_tile = buf;
+            buf += HSQK * kv_blk_;
+        }
+        if (!v_in_place_) {
+            v_tile = buf;
+            buf += kv_blk_ * HSV;
+        }
+        float *s_tile = buf;
+        float *const thr_o_acc = s_tile + q_blk_ * kv_blk_;
+
+        dim_t bo {0}, bi {0}, iq {0}, is {0};
+        impl::utils::nd_iterator_init(
+                start, bo, B, bi, H, iq, nb_q, is, n_kv_splits);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            // A chunk keeps its partial results in the scratchpad until the
+            // merge.
+            float *o_acc = n_kv_splits > 1 ? parts + iwork * part_size
+                                           : thr_o_acc;
+            float *row_max = o_acc + q_blk_ * HSV;
+            float *row_sum = row_max + q_blk_;
+            dim_t kb_start {0}, kb_end {0};
+            balance211(nb_kv, n_kv_splits, is, kb_start, kb_end);
+            const dim_t kv_begin = kb_start * kv_blk_;
+            const dim_t kv_end = std::min(SKV, kb_end * kv_blk_);
+
+            const dim_t kv_head = bi / group_head;
+            const dim_t group_id = bi % group_head;
+            const dim_t q_start = iq * q_blk_;
+            const dim_t M = std::min(q_blk_, SQ - q_start);
+
+            const dim_t q_head_off = cfg.ndims == 4
+                    ? bi * cfg.src1_strides[1]
+                    : kv_head * cfg.src1_strides[1]
+                            + group_id * cfg.src1_strides[2];
+            const float *q = q_ptr + bo * cfg.src1_strides[0] + q_head_off
+                    + q_start * cfg.src1_strides[second_last];
+            // For a paged cache, the batch offset is applied through the
+            // block tables.
+            const dim_t k_batch_off
+                    = cfg.has_paged_kv ? 0 : bo * cfg.wei1_strides[0];
+            const dim_t v_batch_off
+                    = cfg.has_paged_kv ? 0 : bo * cfg.wei2_strides[0];
+            const float *k
+                    = k_ptr + k_batch_off + kv_head * cfg.wei1_strides[1];
+            const float *v
+                    = v_ptr + v_batch_off + kv_head * cfg.wei2_strides[1];
+            const float *mask = nullptr;
+            if (mask_ptr) {
+                dim_t mask_off = 0;
+                if (mask_dims.size() == 4) {
+                    if (mask_dims[0] != 1) mask_off += bo * mask_strides[0];
+                    if (mask_dims[1] != 1) mask_off += bi * mask_strides[1];
+                } else if (mask_dims.size() == 5) {
+                    if (mask_dims[0] != 1) mask_off += bo * mask_strides[0];
+                    if (mask_dims[1] != 1)
+                        mask_off += kv_head * mask_strides[1];
+                    if (mask_dims[2] != 1)
+                        mask_off += group_id * mask_strides[2];
+                }
+                mask = mask_ptr + mask_off + q_start * mask_stride_q;
+            }
+
+            if (!q_in_place_) {
+                for (dim_t m = 0; m < M; m++) {
+                    const float *q_row = q + m * cfg.src1_strides[second_last];
+                    if (cfg.has_rope) {
+                        rotate_row(0, bo, bi, q_start + m, q_row,
+                                cfg.src1_strides[last], q_tile + m * HSQK, 1);
+                        continue;
+                    }
+                    for (dim_t d = 0; d < HSQK; d++)
+                        q_tile[m * HSQK + d]
+                                = q_row[d * cfg.src1_strides[last]];
+                }
+                q = q_tile;
+            }
+
+            std::fill(o_acc, o_acc + M * HSV, 0.f);
+            std::fill(row_max, row_max + M,
+                    -std::numeric_limits<float>::infinity());
+            std::fill(row_sum, row_sum + M, 0.f);
+
+            for (dim_t kv_start = kv_begin; kv_start < kv_end;
+                    kv_start += kv_blk_) {
+                const dim_t N = std::min(kv_blk_, SKV - kv_start);
+
+                // K^T tile of shape [HSQK, N] and V tile of shape [N, HSV].
+                const float *k_blk = k_tile, *v_blk = v_tile;
+                if (cfg.has_paged_kv) {
+                    // A page holds block_size consecutive rows of a head.
+                    const int32_t *k_table
+                            = k_table_ptr + bo * cfg.k_table_strides[0];
+                    const int32_t *v_table
+                            = v_table_ptr + bo * cfg.v_table_strides[0];
+                    for (dim_t n = 0; n < N; n++) {
+                        const dim_t page = (kv_start + n) / cfg.page_size;
+                        const dim_t row = (kv_start + n) % cfg.page_size;
+                        const float *k_row = k
+                                + k_table[page * cfg.k_table_strides[1]]
+                                        * cfg.wei1_strides[0]
+                                + row * cfg.wei1_strides[2];
+                        const float *v_row = v
+                                + v_table[page * cfg.v_table_strides[1]]
+                                        * cfg.wei2_strides[0]
+                                + row * cfg.wei2_strides[2];
+                        for (dim_t d = 0; d < HSQK; d++)
+                            k_tile[d * kv_blk_ + n]
+                                    = k_row[d * cfg.wei1_strides[3]];
+                        for (dim_t d = 0; d < HSV; d++)
+                            v_tile[n * HSV + d]
+                                    = v_row[d * cfg.wei2_strides[3]];
+                    }
+                } else {
+                    if (k_in_place_) {
+                        k_blk = k + kv_start * cfg.wei1_strides[last];
+                    } else {
+                        const float *k_src
+                                = k + kv_start * cfg.wei1_strides[last];
+                        for (dim_t n = 0; n < N; n++) {
+                            const float *k_row
+                                    = k_src + n * cfg.wei1_strides[last];
+                            if (cfg.has_rope) {
+                                rotate_row(2, bo, kv_head, kv_start + n, k_row,
+                                        cfg.wei1_strides[second_last],
+                                        k_tile + n, kv_blk_);
+                                continue;
+                            }
+                            for (dim_t d = 0; d < HSQK; d++)
+                                k_tile[d * kv_blk_ + n] = k_row[d
+                                        * cfg.wei1_strides[second_last]];
+                        }
+                    }
+                    if (v_in_place_) {
+                        v_blk = v + kv_start * cfg.wei2_strides[second_last];
+                    } else {
+                        const float *v_src
+                                = v + kv_start * cfg.wei2_strides[second_last];
+                        for_(dim_t n = 0; n < N; n++)
+                        for (dim_t d = 0; d < HSV; d++)
+                            v_tile[n * HSV + d]
+                                    = v_src[n * cfg.wei2_strides[second_last]
+                                            + d * cfg.wei2_strides[last]];
+                    }
+                }
+
+                gemm_qk(M, N, q, k_blk, s_tile);
+
+                // Online softmax: turn the scores into probabilities relative
+                // to the updated row max and rescale what was accumulated so
+                // far.
+                for (dim_t m = 0; m < M; m++) {
+                    float *s = s_tile + m * kv_blk_;
+                    float blk_max = -std::numeric_limits<float>::infinity();
+                    for (dim_t n = 0; n < N; n++) {
+                        float val = s[n] * scale;
+                        if (mask)
+                            val += mask[m * mask_stride_q
+                                    + (kv_start + n) * mask_stride_kv];
+                        s[n] = val;
+                        blk_max = std::max(blk_max, val);
+                    }
+                    const float max_old = row_max[m];
+                    const float max_new = std::max(max_old, blk_max);
+                    if (max_new == -std::numeric_limits<float>::infinity()) {
+                        // Every score seen so far is masked out.
+                        std::fill(s, s + N, 0.f);
+                        continue;
+                    }
+                    float blk_sum = 0.f;
+                    for (dim_t n = 0; n < N; n++) {
+                        s[n] = ::expf(s[n] - max_new);
+                        blk_sum += s[n];
+                    }
+                    const float alpha = ::expf(max_old - max_new);
+                    row_sum[m] = row_sum[m] * alpha + blk_sum;
+                    row_max[m] = max_new;
+                    if (alpha != 1.f) {
+                        float *o = o_acc + m * HSV;
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t d = 0; d < HSV; d++)
+                            o[d] *= alpha;
+                    }
+                }
+
+                gemm_pv(M, N, s_tile, v_blk, o_acc);
+            }
+
+            if (n_kv_splits == 1)
+                store_dst(M, o_acc, row_sum, get_dst(bo, bi, q_start));
+
+            impl::utils::nd_iterator_step(
+                    bo, B, bi, H, iq, nb_q, is, n_kv_splits);
+        }
+    });
+
+    if (n_kv_splits > 1) {
+        // Rescale the chunks to the global row max and sum them up.
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(work_amount, nthr, ithr, start, end);
+            if (start == end) return;
+
+            float *o_acc = reinterpret_cast<float *>(scratchpad.get_buffer())
+                    + ithr * thr_buf_size;
+            float *row_sum = o_acc + q_blk_ * HSV;
+
+            dim_t bo {0}, bi {0}, iq {0};
+            impl::utils::nd_iterator_init(start, bo, B, bi, H, iq, nb_q);
+            for (dim_t iwork = start; iwork < end; iwork++) {
+                const dim_t q_start = iq * q_blk_;
+                const dim_t M = std::min(q_blk_, SQ - q_start);
+                const float *chunks = parts + iwork * n_kv_splits * part_size;
+
+                for (dim_t m = 0; m < M; m++) {
+                    float max = -std::numeric_limits<float>::infinity();
+                    for (dim_t is = 0; is < n_kv_splits; is++) {
+                        const float *c = chunks + is * part_size;
+                        max = std::max(max, c[q_blk_ * HSV + m]);
+                    }
+                    float *o = o_acc + m * HSV;
+                    std::fill(o, o + HSV, 0.f);
+                    row_sum[m] = 0.f;
+                    // Every score of the row is masked out.
+                    if (max == -std::numeric_limits<float>::infinity())
+                        continue;
+                    for (dim_t is = 0; is < n_kv_splits; is++) {
+                        const float *c = chunks + is * part_size;
+                        const float c_max = c[q_blk_ * HSV + m];
+                        if (c_max == -std::numeric_limits<float>::infinity())
+                            continue;
+                        const float alpha = ::expf(c_max - max);
+                        row_sum[m] += alpha * c[q_blk_ * (HSV + 1) + m];
+                        const float *c_o = c + m * HSV;
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t d = 0; d < HSV; d++)
+                            o[d] += alpha * c_o[d];
+                    }
+                }
+                store_dst(M, o_acc, row_sum, get_dst(bo, bi, q_start));
+
+                impl::utils::nd_iterator_step(bo, B, bi, H, iq, nb_q);
+            }
+        });
+    }
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_FLASH_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_FLASH_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+#include "graph/backend/dnnl/kernels/sdp_decomp_config.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/x64/brgemm/brgemm.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Flash attention style kernel for float SDPA on CPU.
+//
+// The work is split by batch, head and blocks of query rows. For a block of
+// queries the kernel walks over the key/value sequence block by block:
+// S = Q x K^T is computed for the current key block with a brgemm kernel,
+// the scale and the mask are applied, the running row max and row sum are
+// updated (online softmax), the output accumulator is rescaled and then
+// O += exp(S - max) x V is accumulated with another brgemm kernel. The output
+// is normalized by the row sum once all the key blocks are processed, so the
+// [seq_len_q, seq_len_kv] score matrix is never materialized.
+//
+// When there are fewer query blocks than threads, as in decoding where every
+// head has a single query row, the key/value sequence is also split into
+// chunks processed by different threads (flash decoding). The partial
+// outputs of the chunks are merged with their row max and row sum at the end.
+//
+// When the query and the key are rotated by RoPE ops, the rotation is applied
+// while the query and key tiles are copied, so the rotated tensors are never
+// materialized either.
+struct sdp_flash_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    // SDP shapes, strides and input offsets.
+    sdp_decomp_config_t sdp_cfg_;
+
+    dim_t q_blk_ = 0, kv_blk_ = 0;
+    // Number of chunks the key/value sequence is split into, forced by the
+    // internal env var. 0 means it is chosen at execution time.
+    dim_t kv_splits_ = 0;
+    // When a user buffer has a unit stride in the innermost dimension, tiles
+    // are read in place. Otherwise, they are copied to a dense buffer first.
+    // Rotated query and key tiles are always copied.
+    bool q_in_place_ = false, k_in_place_ = false, v_in_place_ = false;
+    dim_t lda_q_ = 0, ldb_k_ = 0, ldb_v_ = 0;
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    // Kernels are indexed by [is_M_tail][is_N_tail] for Q x K^T and by
+    // [is_M_tail][is_K_tail] for P x V. When the kernels can't be generated,
+    // reference loops are used instead.
+    std::unique_ptr<cpu::x64::brgemm_kernel_t> brg_qk_[2][2];
+    std::unique_ptr<cpu::x64::brgemm_kernel_t> brg_pv_[2][2];
+
+    status_t create_brgemm(std::unique_ptr<cpu::x64::brgemm_kernel_t> &ker,
+            dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, dim_t ldc,
+            float beta);
+#endif
+
+    // Returns the number of chunks the key/value sequence is split into.
+    dim_t get_kv_splits(int nthr, dim_t work_amount, dim_t nb_kv) const;
+
+    // Size in floats of the per-thread buffers.
+    size_t thread_buffer_size() const;
+
+public:
+    sdp_flash_kernel_t() = default;
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(sdp_flash_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(sdp_flash_kernel_t)
+    // The kernel doesn't hold any engine specific object.
+    status_t reset_engine(const engine_t *g_engine) override {
+        p_engine_ = make_dnnl_engine(*g_engine);
+        return status::success;
+    }
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
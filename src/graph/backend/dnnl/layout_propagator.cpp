@@ -1709,6 +1709,62 @@ status_t layout_propagator_for_mask(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_paged_cache_load(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    // The gather reads the cache pages and the block table with plain
+    // strides, so blocked inputs are reordered and the output is plain.
+    const dnnl::memory::format_tag plain_tags[]
+            = {dnnl::memory::format_tag::abcd, dnnl::memory::format_tag::ab};
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        auto in_md = make_dnnl_memory_desc(
+                op->get_input_value(i)->get_logical_tensor());
+        if (is_plain(in_md)) continue;
+        auto plain_md = dnnl::memory::desc(
+                in_md.get_dims(), in_md.get_data_type(), plain_tags[i]);
+        insert_reorder_before(
+                op, i, plain_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    value_ptr dst_val = op->get_output_value(0);
+    const logical_tensor_t &out_lt = dst_val->get_logical_tensor();
+    if (!ltw(out_lt).is_any()) return status::success;
+    dnnl::memory::desc dst_md(ltw(out_lt).vdims(),
+            static_cast<dnnl::memory::data_type>(ltw(out_lt).data_type()),
+            dnnl::memory::format_tag::abcd);
+    return fill_layout_info(dst_val, dst_md);
+}
+
+status_t layout_propagator_for_rope(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    // The rotation is computed with plain strides, so blocked inputs are
+    // reordered and the output is plain.
+    for (size_t i = 0; i < 3; i++) {
+        auto in_md = make_dnnl_memory_desc(
+                op->get_input_value(i)->get_logical_tensor());
+        if (is_plain(in_md)) continue;
+        auto plain_md = dnnl::memory::desc(in_md.get_dims(),
+                in_md.get_data_type(), get_ncx_format(in_md.get_ndims()));
+        insert_reorder_before(
+                op, i, plain_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    value_ptr dst_val = op->get_output_value(0);
+    const logical_tensor_t &out_lt = dst_val->get_logical_tensor();
+    if (ltw(out_lt).is_any()) {
+        dnnl::memory::desc dst_md(ltw(out_lt).vdims(),
+                static_cast<dnnl::memory::data_type>(ltw(out_lt).data_type()),
+                get_ncx_format(ltw(out_lt).ndims()));
+        status_t status = fill_layout_info(dst_val, dst_md);
+        if (status != status::success) return status;
+    }
+
+    // The rotation doesn't need any scratchpad.
+    value_ptr scratchpad_val = op->get_output_value(1);
+    return fill_layout_info(scratchpad_val, dnnl::memory::desc());
+}
+
 status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
         pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
@@ -93,6 +93,8 @@ DECLARE_LAYOUT_PROPAGATOR(add_zps);
 DECLARE_LAYOUT_PROPAGATOR(groupnorm);
 DECLARE_LAYOUT_PROPAGATOR(gen_index);
 DECLARE_LAYOUT_PROPAGATOR(mask);
+DECLARE_LAYOUT_PROPAGATOR(paged_cache_load);
+DECLARE_LAYOUT_PROPAGATOR(rope);
 DECLARE_LAYOUT_PROPAGATOR(sdpa);
 DECLARE_LAYOUT_PROPAGATOR(host_scalar);
 
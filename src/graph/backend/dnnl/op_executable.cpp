@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
@@ -25,7 +26,9 @@
 
 #include <graph/utils/utils.hpp>
 
+#include "common/bfloat16.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/stream.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -723,11 +726,16 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     bool use_affine = true;
     if (op->has_attr(op_attr::use_affine))
         use_affine = op->get_attr<bool>(op_attr::use_affine);
+    const bool is_rms_norm = op->has_attr(op_attr::is_rms_norm)
+            && op->get_attr<bool>(op_attr::is_rms_norm);
 
     auto flags = dnnl::normalization_flags::none;
+    // RMSNorm only has the scale.
     if (use_affine)
-        flags |= (dnnl::normalization_flags::use_scale
-                | dnnl::normalization_flags::use_shift);
+        flags |= is_rms_norm ? dnnl::normalization_flags::use_scale
+                             : (dnnl::normalization_flags::use_scale
+                                     | dnnl::normalization_flags::use_shift);
+    if (is_rms_norm) flags |= dnnl::normalization_flags::rms_norm;
 
     prop_kind pkind = keep_stats ? prop_kind::forward_training
                                  : prop_kind::forward_inference;
@@ -1816,6 +1824,138 @@ void genindex_executable_t ::execute(const stream &stream,
     stream.get()->after_exec_hook();
 }
 
+void paged_cache_load_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const auto &it_cache = args.find(DNNL_ARG_SRC_0);
+    const auto &it_table = args.find(DNNL_ARG_SRC_1);
+    const auto &it_dst = args.find(DNNL_ARG_DST);
+    if (it_cache == args.end() || it_table == args.end()
+            || it_dst == args.end())
+        return;
+
+    const auto *cache_ptr
+            = static_cast<const char *>(it_cache->second.get_data_handle());
+    const auto *table_ptr
+            = static_cast<const int32_t *>(it_table->second.get_data_handle());
+    auto *dst_ptr = static_cast<char *>(it_dst->second.get_data_handle());
+
+    const dim_t B = dst_dims_[0], H = dst_dims_[1], S = dst_dims_[2],
+                D = dst_dims_[3];
+    const bool dense_rows = cache_strides_[3] == 1 && dst_strides_[3] == 1;
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(B, H, S, [&](dim_t b, dim_t h, dim_t s) {
+        const dim_t blk = table_ptr[b * table_strides_[0]
+                + (s / block_size_) * table_strides_[1]];
+        const dim_t src_off = blk * cache_strides_[0] + h * cache_strides_[1]
+                + (s % block_size_) * cache_strides_[2];
+        const dim_t dst_off = b * dst_strides_[0] + h * dst_strides_[1]
+                + s * dst_strides_[2];
+        if (dense_rows) {
+            std::memcpy(dst_ptr + dst_off * dt_size_,
+                    cache_ptr + src_off * dt_size_, D * dt_size_);
+            return;
+        }
+        for (dim_t d = 0; d < D; d++)
+            std::memcpy(dst_ptr + (dst_off + d * dst_strides_[3]) * dt_size_,
+                    cache_ptr + (src_off + d * cache_strides_[3]) * dt_size_,
+                    dt_size_);
+    });
+    stream.get()->after_exec_hook();
+}
+
+template <typename T>
+void rope_executable_t::execute_impl(
+        const T *src, const T *cos, const T *sin, T *dst) const {
+    const int last = ndims_ - 1;
+    const dim_t D = dims_[last];
+    const dim_t half = D / 2;
+    dim_t nrows = 1;
+    for (int i = 0; i < last; i++)
+        nrows *= dims_[i];
+    const bool dense_rows = src_strides_[last] == 1
+            && dst_strides_[last] == 1 && cos_strides_[last] == 1
+            && sin_strides_[last] == 1;
+
+    dnnl::impl::parallel_nd(nrows, [&](dim_t r) {
+        dims_t pos; // position of the row in the outer dimensions
+        dnnl::impl::utils::l_dims_by_l_offset(pos, r, dims_, last);
+        const T *x = src + utils::offset_compute(src_strides_, pos, last);
+        const T *c = cos + utils::offset_compute(cos_strides_, pos, last);
+        const T *s = sin + utils::offset_compute(sin_strides_, pos, last);
+        T *y = dst + utils::offset_compute(dst_strides_, pos, last);
+
+        if (!dense_rows) {
+            for (dim_t d = 0; d < D; d++) {
+                float sign = 1.f;
+                const dim_t p = get_pair(d, D, interleaved_, sign);
+                y[d * dst_strides_[last]]
+                        = static_cast<float>(x[d * src_strides_[last]])
+                                * c[d * cos_strides_[last]]
+                        + sign * static_cast<float>(x[p * src_strides_[last]])
+                                * s[d * sin_strides_[last]];
+            }
+            return;
+        }
+
+        // Both elements of a pair are read before either is written, so the
+        // rotation is safe in place.
+        if (interleaved_) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < half; i++) {
+                const float x0 = x[2 * i], x1 = x[2 * i + 1];
+                y[2 * i] = x0 * c[2 * i] - x1 * s[2 * i];
+                y[2 * i + 1] = x1 * c[2 * i + 1] + x0 * s[2 * i + 1];
+            }
+        } else {
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < half; i++) {
+                const float x0 = x[i], x1 = x[i + half];
+                y[i] = x0 * c[i] - x1 * s[i];
+                y[i + half] = x1 * c[i + half] + x0 * s[i + half];
+            }
+        }
+    });
+}
+
+void rope_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const auto &it_src = args.find(DNNL_ARG_SRC_0);
+    const auto &it_cos = args.find(DNNL_ARG_SRC_1);
+    const auto &it_sin = args.find(DNNL_ARG_SRC_2);
+    const auto &it_dst = args.find(DNNL_ARG_DST);
+    if (it_src == args.end() || it_cos == args.end() || it_sin == args.end()
+            || it_dst == args.end())
+        return;
+
+    const void *src_ptr = it_src->second.get_data_handle();
+    const void *cos_ptr = it_cos->second.get_data_handle();
+    const void *sin_ptr = it_sin->second.get_data_handle();
+    void *dst_ptr = it_dst->second.get_data_handle();
+
+    stream.get()->before_exec_hook();
+    switch (dt_) {
+        case graph::data_type::bf16:
+            execute_impl(static_cast<const bfloat16_t *>(src_ptr),
+                    static_cast<const bfloat16_t *>(cos_ptr),
+                    static_cast<const bfloat16_t *>(sin_ptr),
+                    static_cast<bfloat16_t *>(dst_ptr));
+            break;
+        case graph::data_type::f16:
+            execute_impl(static_cast<const float16_t *>(src_ptr),
+                    static_cast<const float16_t *>(cos_ptr),
+                    static_cast<const float16_t *>(sin_ptr),
+                    static_cast<float16_t *>(dst_ptr));
+            break;
+        default:
+            execute_impl(static_cast<const float *>(src_ptr),
+                    static_cast<const float *>(cos_ptr),
+                    static_cast<const float *>(sin_ptr),
+                    static_cast<float *>(dst_ptr));
+    }
+    stream.get()->after_exec_hook();
+}
+
 static void get_arg_indices_for_post_ops(const op_t *op, fusion_info_mgr_t &mgr,
         arg_indices_t &indices, size_t &base_index) {
     const fusion_info_t &fusion_info
@@ -2248,7 +2388,11 @@ static arg_indices_t get_arg_indices_for_lnorm_and_gnorm(
     if (!op->has_attr(op_attr::use_affine)
             || op->get_attr<bool>(op_attr::use_affine)) {
         arg_indices.insert({DNNL_ARG_SCALE, indices_t {input, in_index++}});
-        arg_indices.insert({DNNL_ARG_SHIFT, indices_t {input, in_index++}});
+        // RMSNorm doesn't have the shift.
+        if (!op->has_attr(op_attr::is_rms_norm)
+                || !op->get_attr<bool>(op_attr::is_rms_norm))
+            arg_indices.insert(
+                    {DNNL_ARG_SHIFT, indices_t {input, in_index++}});
     }
 
     const fusion_info_t &fusion_info
@@ -2436,6 +2580,33 @@ arg_indices_t genindex_executable_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t paged_cache_load_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
+arg_indices_t rope_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_SRC_2, indices_t {input, 2}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
 arg_indices_t sdpa_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     UNUSED(mgr);
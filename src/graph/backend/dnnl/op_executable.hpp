@@ -2866,6 +2866,189 @@ private:
 #endif
 };
 
+// Gathers the pages of a paged KV cache into a dense [B, H, S, D] tensor:
+// dst[b, h, s, d] = cache[table[b, s / block_size], h, s % block_size, d].
+// Only implemented for CPU engines.
+struct paged_cache_load_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    paged_cache_load_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache) {
+        UNUSED(p_engine);
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+        using ltw = logical_tensor_wrapper_t;
+        const auto &cache_lt = op->get_input_value(0)->get_logical_tensor();
+        const auto &table_lt = op->get_input_value(1)->get_logical_tensor();
+        const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+        for (int i = 0; i < 4; i++) {
+            cache_strides_[i] = cache_lt.layout.strides[i];
+            dst_dims_[i] = dst_lt.dims[i];
+            dst_strides_[i] = dst_lt.layout.strides[i];
+        }
+        block_size_ = cache_lt.dims[2];
+        table_strides_[0] = table_lt.layout.strides[0];
+        table_strides_[1] = table_lt.layout.strides[1];
+        dt_size_ = ltw(cache_lt).data_type_size();
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        if (stream.get_engine().get_kind() == engine::kind::cpu) {
+            auto strm_t = stream.get();
+            auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                    dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+            strm_t->before_exec_hook();
+            if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+            execute(stream, args);
+
+            ::sycl::event return_event = sycl_stream_impl->get_output_event();
+            strm_t->after_exec_hook();
+            return return_event;
+        }
+        assertm(false,
+                "paged_cache_load opexcutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false,
+                "paged_cache_load opexcutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    dims_t cache_strides_, dst_dims_, dst_strides_;
+    dim_t table_strides_[2];
+    dim_t block_size_;
+    size_t dt_size_;
+};
+
+// Rotary position embedding over the last dimension of src:
+// dst[..., d] = src[..., d] * cos[..., d] + sign * src[..., pair] * sin[..., d]
+// cos and sin are broadcast to src over the dimensions of size 1. Only
+// implemented for CPU engines.
+struct rope_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    rope_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        UNUSED(p_engine);
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+        const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+        const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+        ndims_ = src_lt.ndims;
+        for (int i = 0; i < ndims_; i++) {
+            dims_[i] = src_lt.dims[i];
+            src_strides_[i] = src_lt.layout.strides[i];
+            dst_strides_[i] = dst_lt.layout.strides[i];
+        }
+        // cos and sin are aligned to the innermost dimension of src. A zero
+        // stride broadcasts them.
+        for (size_t i = 1; i < 3; i++) {
+            const auto &lt = op->get_input_value(i)->get_logical_tensor();
+            dim_t *strides = i == 1 ? cos_strides_ : sin_strides_;
+            const int off = ndims_ - lt.ndims;
+            for (int d = 0; d < ndims_; d++) {
+                strides[d] = d < off || lt.dims[d - off] == 1
+                        ? 0
+                        : lt.layout.strides[d - off];
+            }
+        }
+        dt_ = static_cast<data_type_t>(src_lt.data_type);
+        interleaved_ = op->has_attr(op_attr::mode)
+                && op->get_attr<std::string>(op_attr::mode) == "interleaved";
+    }
+
+    // Returns the index of the element rotated with element `d` of a row of
+    // `D` elements and sets the sign it is multiplied with.
+    static dim_t get_pair(dim_t d, dim_t D, bool interleaved, float &sign) {
+        if (interleaved) {
+            sign = d % 2 == 0 ? -1.f : 1.f;
+            return d ^ 1;
+        }
+        const dim_t half = D / 2;
+        sign = d < half ? -1.f : 1.f;
+        return d < half ? d + half : d - half;
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        if (stream.get_engine().get_kind() == engine::kind::cpu) {
+            auto strm_t = stream.get();
+            auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                    dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+            strm_t->before_exec_hook();
+            if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+            execute(stream, args);
+
+            ::sycl::event return_event = sycl_stream_impl->get_output_event();
+            strm_t->after_exec_hook();
+            return return_event;
+        }
+        assertm(false, "rope opexcutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "rope opexcutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    // Rotates all rows of src. The data type is dispatched once by the
+    // caller, and rows dense in the last dimension run vectorized loops.
+    template <typename T>
+    void execute_impl(const T *src, const T *cos, const T *sin, T *dst) const;
+
+    int ndims_;
+    dims_t dims_, src_strides_, cos_strides_, sin_strides_, dst_strides_;
+    data_type_t dt_;
+    bool interleaved_;
+};
+
 struct sdpa_executable_t : public op_executable_t {
     DECLARE_ARG_INDICES_GETTER;
 
@@ -185,6 +185,25 @@ static status_t batchnorm_fwd_handler(
     return status::success;
 }
 
+static status_t rms_norm_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    // RMSNorm is a layer normalization without the mean subtraction and the
+    // shift. It's computed by the layer normalization primitive with the
+    // rms_norm flag.
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_layernorm);
+    new_op->merge_attributes(op->get_attributes());
+    new_op->set_attr<bool>(op_attr::is_rms_norm, true);
+    new_op->set_attr<bool>(op_attr::keep_stats, false);
+    const bool use_affine = op->num_inputs() > 1
+            && (!op->has_attr(op_attr::use_affine)
+                    || op->get_attr<bool>(op_attr::use_affine));
+    new_op->set_attr<bool>(op_attr::use_affine, use_affine);
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 static status_t reduction_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
 
@@ -977,6 +996,7 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // layernorm
         ITEM(LayerNorm, common_handler<op_kind::kDnnl_layernorm>),
         ITEM(LayerNormBackward, common_handler<op_kind::kDnnl_layernorm_bwd>),
+        ITEM(RMSNorm, rms_norm_handler),
         // groupnorm
         ITEM(GroupNorm, common_handler<op_kind::kDnnl_groupnorm>),
         // quantization
@@ -996,6 +1016,8 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(SquaredDifference, squared_difference_handler),
         ITEM(Select, select_handler),
         ITEM(GenIndex, gen_index_handler),
+        ITEM(PagedCacheLoad, common_handler<op_kind::kDnnl_paged_cache_load>),
+        ITEM(RoPE, common_handler<op_kind::kDnnl_rope>),
         // utility
         ITEM(Wildcard, dummy_handler),
         ITEM(End, dummy_handler),
@@ -134,6 +134,59 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion_cpu)
             return std::make_shared<sdp_base_t<>>();
         });
 
+// The key and the value are gathered from paged KV caches. The priority is
+// higher than float_sdp_fusion_cpu so the PagedCacheLoad ops are fused into the
+// SDP partition.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_paged_kv_fusion_cpu)
+        .set_priority(21.1f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto k_load = pgraph->append_op(
+                            graph::op_kind::PagedCacheLoad);
+                    auto matmul_qk = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(1, k_load, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto v_load = pgraph->append_op(
+                            graph::op_kind::PagedCacheLoad);
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, softmax, 0), in_edge(1, v_load, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
+// The query and the key are rotated by RoPE ops. The priority is higher than
+// float_sdp_fusion_cpu so the RoPE ops are fused into the SDP partition.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_rope_fusion_cpu)
+        .set_priority(21.1f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto q_rope = pgraph->append_op(graph::op_kind::RoPE);
+                    auto k_rope = pgraph->append_op(graph::op_kind::RoPE);
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, q_rope, 0), in_edge(1, k_rope, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto matmul_v = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(0, softmax, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_gemma_fusion_cpu)
         .set_priority(21.0f)
         .set_kind(partition_kind_t::sdp)
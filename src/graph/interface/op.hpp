@@ -417,6 +417,7 @@ public:
             CASE(Mish);
             CASE(MishBackward);
             CASE(Multiply);
+            CASE(PagedCacheLoad);
             CASE(Pow);
             CASE(PReLU);
             CASE(PReLUBackward);
@@ -432,6 +433,8 @@ public:
             CASE(ReLU);
             CASE(ReLUBackward);
             CASE(Reorder);
+            CASE(RMSNorm);
+            CASE(RoPE);
             CASE(Round);
             CASE(Select);
             CASE(Sigmoid);
@@ -821,6 +821,19 @@ DNNL_GRAPH_OP_SCHEMA(Multiply, 1,
                 .set_shape_inference_function(
                         infer_elemwise_arithmetic_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(PagedCacheLoad, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "cache", "T1")
+                .set_input(1, "block_table", "T2")
+                .set_output(0, "dst", "T1")
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_shape_inference_function(
+                        infer_paged_cache_load_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Pow, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -989,6 +1002,37 @@ DNNL_GRAPH_OP_SCHEMA(ReLUBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(RMSNorm, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({1, 2}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "gamma", "T2")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::begin_norm_axis, false, attribute_kind::i,
+                        int64_t(-1))
+                .set_attr(op_attr::use_affine, false, attribute_kind::b, true)
+                .set_attr(op_attr::epsilon, false, attribute_kind::f, 1e-5f)
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::f32, data_type::bf16})
+                .set_shape_inference_function(infer_identity_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(RoPE, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(1)
+                .set_input(0, "src", "T")
+                .set_input(1, "cos", "T")
+                .set_input(2, "sin", "T")
+                .set_output(0, "dst", "T")
+                .set_attr(op_attr::mode, false, attribute_kind::s,
+                        "rotate_half", {"rotate_half", "interleaved"})
+                .set_type_constraints(
+                        "T", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_shape_inference_function(infer_rope_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Round, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -1770,6 +1770,80 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_paged_cache_load_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto cache = logical_tensor_wrapper_t(inputs[0]);
+    auto block_table = logical_tensor_wrapper_t(inputs[1]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    // cache: [num_blocks, num_head, block_size, head_size]
+    // block_table: [batch_size, max_num_blocks_per_seq]
+    VCHECK_INVALID_SHAPE(cache.ndims() == 4 && block_table.ndims() == 2,
+            "%s, cache should be 4D and block_table should be 2D, but got "
+            "%d and %d",
+            op_t::kind2str(n->get_kind()).c_str(), cache.ndims(),
+            block_table.ndims());
+
+    const dims cache_dims = cache.vdims();
+    const dims block_table_dims = block_table.vdims();
+    const dim_t max_seq_len = block_table_dims[1] * cache_dims[2];
+    // dst: [batch_size, num_head, seq_len, head_size]
+    dims output_dims = {block_table_dims[0], cache_dims[1], max_seq_len,
+            cache_dims[3]};
+
+    // check if output shape is already known. The sequence length can be
+    // shorter than the capacity of the blocks in the block table.
+    if (!out0.is_shape_unknown()) {
+        const dims expected = out0.vdims();
+        VCHECK_INVALID_SHAPE(expected.size() == 4
+                        && expected[2] != DNNL_GRAPH_UNKNOWN_DIM
+                        && expected[2] <= max_seq_len,
+                "%s, output sequence length should not exceed %ld",
+                op_t::kind2str(n->get_kind()).c_str(),
+                static_cast<long int>(max_seq_len));
+        output_dims[2] = expected[2];
+        VCHECK_INVALID_SHAPE(validate(output_dims, expected),
+                "%s, inferred output shape and shape from logical tensor are "
+                "not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
+status_t infer_rope_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto src = logical_tensor_wrapper_t(inputs[0]);
+    const dims src_dims = src.vdims();
+    const int ndims = src.ndims();
+    VCHECK_INVALID_SHAPE(ndims >= 1 && src_dims[ndims - 1] % 2 == 0,
+            "%s, the last dimension of src should be even",
+            op_t::kind2str(n->get_kind()).c_str());
+
+    // cos and sin are multiplied with src elementwisely, so they should cover
+    // the full last dimension and be broadcastable to src in the others.
+    for (size_t i = 1; i < inputs.size(); i++) {
+        auto in = logical_tensor_wrapper_t(inputs[i]);
+        const dims in_dims = in.vdims();
+        const int in_ndims = in.ndims();
+        bool ok = in_ndims >= 1 && in_ndims <= ndims
+                && in_dims[in_ndims - 1] == src_dims[ndims - 1];
+        for (int d = 2; ok && d <= in_ndims; d++) {
+            const dim_t in_d = in_dims[in_ndims - d];
+            ok = in_d == 1 || in_d == src_dims[ndims - d];
+        }
+        VCHECK_INVALID_SHAPE(ok,
+                "%s, input %zu should be broadcastable to src and have the "
+                "same last dimension",
+                op_t::kind2str(n->get_kind()).c_str(), i);
+    }
+
+    return infer_identity_output_shape(n, inputs, outputs);
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
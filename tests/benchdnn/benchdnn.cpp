@@ -213,6 +213,7 @@ int main(int argc, char **argv) {
         printf(" %s: %.2fs (%.0f%%);", t_print_name.c_str(), s, r_s_to_total);
     }
     printf("\n");
+    print_primitive_cache_stats();
 
     finalize();
 
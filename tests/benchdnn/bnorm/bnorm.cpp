@@ -523,8 +523,13 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     const bool bnorm_single_pass = false;
 #endif
 
-    const bool use_relaxed_validation
-            = is_nvidia_gpu() || is_amd_gpu() || bnorm_single_pass;
+    // Relaxed accumulation lets CPU compute statistics in a single pass.
+    const bool relaxed_acc_mode
+            = !(prb->attr.acc_mode == dnnl_accumulation_mode_strict
+                    || prb->attr.acc_mode == dnnl_accumulation_mode_f32);
+
+    const bool use_relaxed_validation = is_nvidia_gpu() || is_amd_gpu()
+            || bnorm_single_pass || relaxed_acc_mode;
     if (use_relaxed_validation) {
         // Nvidia (cuDNN) and AMD (MIOpen): store unbiased variance which
         // requires rescaling by `(N - 1) / N`, where `N = MB * Spatial`.
@@ -94,6 +94,16 @@ int check_primitive_cache(dnnl_primitive_t p, res_t *res) {
     return OK;
 }
 
+void print_primitive_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::cache_stats_t stats;
+    if (dnnl::impl::get_primitive_cache_stats(&stats) != dnnl_success) return;
+    BENCHDNN_PRINT(1,
+            "primitive cache: hits:%zu misses:%zu contended_locks:%zu\n",
+            stats.hits, stats.misses, stats.contended_locks);
+#endif
+}
+
 size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     return dnnl::impl::set_primitive_cache_capacity_without_clearing(capacity);
@@ -88,6 +88,7 @@ extern "C" dnnl_status_t dnnl_query_profiling_data(dnnl_stream_t stream,
 
 int check_pd_cache(const_dnnl_primitive_desc_t pd, res_t *res);
 int check_primitive_cache(dnnl_primitive_t p, res_t *res);
+void print_primitive_cache_stats();
 
 extern dnnl_engine_kind_t engine_tgt_kind;
 extern size_t engine_index;
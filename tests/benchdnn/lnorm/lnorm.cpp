@@ -497,6 +497,16 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     float trh = trh_coeff * ((kind == SRC || kind == DST) ? 5e-7 : 0);
     if ((kind == SC || kind == SH) && prb->dir & FLAG_BWD)
         trh = trh_coeff * 5e-6;
+
+    // Relaxed accumulation lets CPU compute statistics in a single pass.
+    const bool is_strict_acc
+            = prb->attr.acc_mode == dnnl_accumulation_mode_strict
+            || prb->attr.acc_mode == dnnl_accumulation_mode_f32;
+    if (!is_strict_acc && (prb->dir & FLAG_FWD)) {
+        if (kind == MEAN) trh = 1e-7f;
+        if (kind == VAR) trh = 5e-7f;
+        if (kind == DST) trh = MAX2(trh, 2e-6f);
+    }
     cmp.set_threshold(trh);
 
     // u8 turns half of output into zeros.
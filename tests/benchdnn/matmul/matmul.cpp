@@ -482,9 +482,15 @@ int fill_data(data_kind_t kind, const prb_t *prb, const cfg_t &cfg,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
+    // fp4 weights are up-converted to the source data type before compute,
+    // hence they don't require native fp4 support.
+    const bool is_fp4_wei_decompression
+            = (prb->wei_dt() == dnnl_f4_e2m1 || prb->wei_dt() == dnnl_f4_e3m0)
+            && prb->src_dt() != prb->wei_dt();
+    const auto wei_dt
+            = is_fp4_wei_decompression ? prb->src_dt() : prb->wei_dt();
     skip_unimplemented_data_type(
-            {prb->src_dt(), prb->wei_dt(), prb->bia_dt, prb->dst_dt()},
-            prb->dir, res);
+            {prb->src_dt(), wei_dt, prb->bia_dt, prb->dst_dt()}, prb->dir, res);
     skip_unimplemented_sum_po(
             prb->attr, res, dnnl_matmul, prb->src_dt(), prb->dst_dt());
     skip_unimplemented_binary_po(prb->attr, res);
@@ -733,8 +739,10 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
         }
     }
 
-    // Check int4 weights byte alignment if format is specified.
-    if ((prb->wei_dt() == dnnl_s4 || prb->wei_dt() == dnnl_u4)
+    // Check 4-bit weights byte alignment if format is specified.
+    if ((prb->wei_dt() == dnnl_s4 || prb->wei_dt() == dnnl_u4
+                || prb->wei_dt() == dnnl_f4_e2m1
+                || prb->wei_dt() == dnnl_f4_e3m0)
             && (!prb->strides[WEI].empty()
                     || (prb->wtag != tag::any && prb->wtag != tag::undef))) {
         const auto &weights_rt_dims = get_runtime_dims(
@@ -750,7 +758,7 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
                 n_unit_strides++;
                 if (n_unit_strides > 1) {
                     BENCHDNN_PRINT(2,
-                            "[INVALID][%s:%d]: Int4 Weights decompression "
+                            "[INVALID][%s:%d]: 4-bit weights decompression "
                             "requires byte alignment for the tensor.\n",
                             __FILE__, __LINE__);
                     res->state = SKIPPED;
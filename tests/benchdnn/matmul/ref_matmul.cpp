@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2025 Intel Corporation
+* Copyright 2019-2026 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <vector>
 
 #include "utils/parallel.hpp"
 
@@ -219,7 +220,14 @@ void cvt_coo_indices_to_csr_pointers(const int32_t *indices, int32_t *pointers,
 void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &src_m = args.find(DNNL_ARG_SRC);
     const dnn_mem_t &wei_m = args.find(DNNL_ARG_WEIGHTS);
+    const dnn_mem_t &bia_m = args.find(DNNL_ARG_BIAS);
     const dnn_mem_t &dst_m = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &src_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const dnn_mem_t &wei_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const dnn_mem_t &dst_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
     const auto src_encoding = prb->sparse_options.get_encoding(DNNL_ARG_SRC);
     const auto wei_encoding
@@ -243,9 +251,9 @@ void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
 
     // Batch is not supported.
     const int64_t mb = 0;
-    benchdnn_parallel_nd(M, N, [&](int64_t m, int64_t n) {
-        dst_m.set_f32_elem(dst_off_f(prb, mb, m, n), 0.0f);
-    });
+    // The accumulator is kept separately from dst as the latter is used by
+    // the sum post-op.
+    std::vector<float> acc(M * N, 0.0f);
 
     if (is_wei_sparse) {
         int32_t *wei_indices = wei_m.get_mapped_pointer<int32_t>(
@@ -269,13 +277,9 @@ void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
                 const int64_t row_end = wei_pointers[k + 1];
                 for (int64_t n = row_start; n < row_end; n++) {
                     const int64_t src_idx = src_off_f(prb, mb, m, k);
-                    const int64_t dst_idx
-                            = dst_off_f(prb, mb, m, wei_indices[n]);
                     const float src_val = src_m.get_f32_elem(src_idx);
                     const float wei_val = wei_m.get_elem(n, 0);
-                    float dst_val = dst_m.get_f32_elem(dst_idx);
-                    dst_val += src_val * wei_val;
-                    dst_m.set_f32_elem(dst_idx, dst_val);
+                    acc[m * N + wei_indices[n]] += src_val * wei_val;
                 }
             }
         });
@@ -296,9 +300,7 @@ void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
             const int64_t row_start = src_pointers[m];
             const int64_t row_end = src_pointers[m + 1];
             for (int64_t n = 0; n < N; n++) {
-                const int64_t dst_idx = dst_off_f(prb, mb, m, n);
-                float dst_val = dst_m.get_f32_elem(dst_idx);
-
+                float dst_val = 0.0f;
                 for (int64_t k = row_start; k < row_end; k++) {
                     const int64_t wei_idx
                             = wei_ba_off_f(prb, mb, src_indices[k], n);
@@ -306,10 +308,42 @@ void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
                     const float wei_val = wei_m.get_f32_elem(wei_idx);
                     dst_val += src_val * wei_val;
                 }
-                dst_m.set_f32_elem(dst_idx, dst_val);
+                acc[m * N + n] = dst_val;
             }
         });
     }
+
+    const bool has_src_scale = !prb->attr.scales.get(DNNL_ARG_SRC).is_def();
+    const bool has_wei_scale = !prb->attr.scales.get(DNNL_ARG_WEIGHTS).is_def();
+    const bool has_dst_scale = !prb->attr.scales.get(DNNL_ARG_DST).is_def();
+    const int wei_scale_mask
+            = prb->attr.scales.get_mask(DNNL_ARG_WEIGHTS, dnnl_matmul, 2);
+
+    const auto bias_broadcast_mask = prb->bias_broadcast_mask();
+    auto v_po_masks = prb->attr.post_ops.get_po_masks(prb->ndims);
+
+    // Only common and per N scales are supported for sparse problems, hence
+    // they are applied to the accumulator.
+    benchdnn_parallel_nd(M, N, [&](int64_t m, int64_t n) {
+        float dst = acc[m * N + n];
+        if (has_src_scale) dst *= src_scales.get_f32_elem(0);
+        if (has_wei_scale)
+            dst *= wei_scales.get_f32_elem(wei_scale_mask > 0 ? n : 0);
+
+        const auto dst_off = dst_off_f(prb, mb, m, n);
+        if (prb->bia_dt != dnnl_data_type_undef) {
+            const auto bia_idx = dst_m.get_idx(dst_off, bias_broadcast_mask);
+            dst += bia_m.get_f32_elem(bia_idx);
+        }
+
+        const auto v_po_vals
+                = prepare_po_vals(dst_m, args, v_po_masks, dst_off);
+        const auto sum_val = dst_m.get_f32_elem(dst_off);
+        maybe_post_ops(prb->attr, dst, sum_val, v_po_vals);
+
+        if (has_dst_scale) dst *= 1.f / dst_scales.get_f32_elem(0);
+        dst_m.set_f32_elem(dst_off, dst);
+    });
 }
 
 void compute_ref(const prb_t *prb, dir_t dir, const args_t &args,
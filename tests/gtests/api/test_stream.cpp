@@ -137,6 +137,40 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_c_t, MaxThreads) {
+    dnnl_engine_t engine;
+    DNNL_CHECK(dnnl_engine_create(&engine, dnnl_cpu, 0));
+
+    dnnl_stream_t stream;
+    DNNL_CHECK(dnnl_stream_create(&stream, engine, dnnl_stream_default_flags));
+
+    int max_threads = -1;
+    DNNL_CHECK(dnnl_stream_get_max_threads(stream, &max_threads));
+    ASSERT_EQ(max_threads, 0);
+
+    DNNL_CHECK(dnnl_stream_set_max_threads(stream, 2));
+    DNNL_CHECK(dnnl_stream_get_max_threads(stream, &max_threads));
+    ASSERT_EQ(max_threads, 2);
+
+    ASSERT_EQ(dnnl_stream_set_max_threads(stream, -1), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_get_max_threads(stream, nullptr),
+            dnnl_invalid_arguments);
+
+    DNNL_CHECK(dnnl_stream_destroy(stream));
+    DNNL_CHECK(dnnl_engine_destroy(engine));
+}
+
+TEST(stream_test_cpp_t, MaxThreads) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    ASSERT_EQ(s.get_max_threads(), 0);
+    ASSERT_EQ(s.set_max_threads(4).get_max_threads(), 4);
+    ASSERT_EQ(s.set_max_threads(0).get_max_threads(), 0);
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
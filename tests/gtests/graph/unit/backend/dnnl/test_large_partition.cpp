@@ -23,6 +23,10 @@
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include <omp.h>
+#endif
+
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
 
@@ -1378,3 +1382,149 @@ TEST(test_large_partition_execute, Int8Bf16GptMha_CPU) {
             graph::status::success);
     strm->wait();
 }
+
+static void check_gated_mlp_fused(bool swish, bool in_parallel_region) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    // Row and intermediate sizes are not multiples of the kernel blocks.
+    const graph::dim_t B = 1, M = 5, K = 64, I = 200, N = 48;
+    const auto f32 = graph::data_type::f32;
+
+    auto src = utils::logical_tensor_init(0, {B, M, K}, f32);
+    auto wei_gate = utils::logical_tensor_init(1, {K, I}, f32);
+    auto wei_up = utils::logical_tensor_init(2, {K, I}, f32);
+    auto wei_down = utils::logical_tensor_init(3, {I, N}, f32);
+    auto gate = utils::logical_tensor_init(4, {B, M, I}, f32);
+    auto up = utils::logical_tensor_init(5, {B, M, I}, f32);
+    auto sig = utils::logical_tensor_init(6, {B, M, I}, f32);
+    auto act = utils::logical_tensor_init(7, {B, M, I}, f32);
+    auto hidden = utils::logical_tensor_init(8, {B, M, I}, f32);
+    auto dst = utils::logical_tensor_init(9, {B, M, N}, f32);
+
+    graph::op_t mm_gate(0, graph::op_kind::MatMul, "mm_gate");
+    mm_gate.add_input(src);
+    mm_gate.add_input(wei_gate);
+    mm_gate.add_output(gate);
+    graph::op_t mm_up(1, graph::op_kind::MatMul, "mm_up");
+    mm_up.add_input(src);
+    mm_up.add_input(wei_up);
+    mm_up.add_output(up);
+    graph::op_t sigmoid(2, graph::op_kind::Sigmoid, "sigmoid");
+    sigmoid.add_input(gate);
+    sigmoid.add_output(sig);
+    graph::op_t swish_mul(3, graph::op_kind::Multiply, "swish_mul");
+    swish_mul.add_input(gate);
+    swish_mul.add_input(sig);
+    swish_mul.add_output(act);
+    graph::op_t gelu(4, graph::op_kind::GELU, "gelu");
+    gelu.add_input(gate);
+    gelu.add_output(act);
+    graph::op_t mul(5, graph::op_kind::Multiply, "mul");
+    mul.add_input(act);
+    mul.add_input(up);
+    mul.add_output(hidden);
+    graph::op_t mm_down(6, graph::op_kind::MatMul, "mm_down");
+    mm_down.add_input(hidden);
+    mm_down.add_input(wei_down);
+    mm_down.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&mm_gate), graph::status::success);
+    ASSERT_EQ(g.add_op(&mm_up), graph::status::success);
+    if (swish) {
+        ASSERT_EQ(g.add_op(&sigmoid), graph::status::success);
+        ASSERT_EQ(g.add_op(&swish_mul), graph::status::success);
+    } else {
+        ASSERT_EQ(g.add_op(&gelu), graph::status::success);
+    }
+    ASSERT_EQ(g.add_op(&mul), graph::status::success);
+    ASSERT_EQ(g.add_op(&mm_down), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass(swish ? "gated_mlp_v1" : "gated_mlp");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 4U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    for (auto &lt : partition_outputs)
+        outputs.emplace_back(&lt);
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+
+    // The reference runs the ops as separate primitives.
+    std::vector<test_tensor_t> outputs_ts[2];
+    for (int fused = 0; fused < 2; fused++) {
+        custom_setenv("_ONEDNN_GRAPH_GATED_MLP_ENABLE_FUSED",
+                fused ? "1" : "0", 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts[fused].emplace_back(compiled_output, eng);
+        }
+        const auto execute = [&]() {
+            return cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                    test_tensor_t::to_graph_tensor(outputs_ts[fused]));
+        };
+        graph::status_t status = graph::status::success;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        if (fused && in_parallel_region) {
+            // Nested parallel sections run on a single thread, while the
+            // kernel plans its grid for the 4 threads set below.
+#pragma omp parallel num_threads(2)
+            if (omp_get_thread_num() == 0) {
+                omp_set_num_threads(4);
+                status = execute();
+            }
+        } else
+            status = execute();
+#else
+        status = execute();
+#endif
+        ASSERT_EQ(status, graph::status::success);
+        strm->wait();
+    }
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0][0], outputs_ts[1][0],
+            /*rtol*/ 0.01f,
+            /*atol*/ 1e-5f));
+}
+
+TEST(test_large_partition_execute, F32GatedMlpFusedCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - fused kernel is for CPU only.");
+
+    // swish as Sigmoid + Multiply and as a single op (GELU) for the gate.
+    for (const bool swish : {true, false})
+        check_gated_mlp_fused(swish, false);
+}
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+TEST(test_large_partition_execute, F32GatedMlpFusedInParallelRegion_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - fused kernel is for CPU only.");
+
+    check_gated_mlp_fused(true, true);
+}
+#endif
@@ -277,6 +277,136 @@ TEST(test_layer_norm_execute, LayernormInferenceWithoutScaleShift) {
     }
 }
 
+TEST(test_layer_norm_execute, RMSNormInference) {
+    graph::engine_t *eng = get_engine();
+
+    std::vector<float> src {3.0, 4.0, 1.0, -1.0, 6.0, 8.0};
+    std::vector<float> gamma {1.0, 2.0};
+    // dst = src * gamma / sqrt(mean(src^2))
+    std::vector<float> ref_dst {
+            0.8485281, 2.2627417, 1.0, -2.0, 0.8485281, 2.2627417};
+    std::vector<float> dst(src.size(), 0.0);
+
+    graph::op_t rms_norm_op(graph::op_kind::RMSNorm);
+    rms_norm_op.set_attr<float>(graph::op_attr::epsilon, 0);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t gamma_lt
+            = utils::logical_tensor_init(1, {2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, {1, 3, 2}, graph::data_type::f32);
+
+    rms_norm_op.add_input(src_lt);
+    rms_norm_op.add_input(gamma_lt);
+    rms_norm_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&rms_norm_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rms_norm_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &gamma_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t gamma_ts(gamma_lt, eng, gamma);
+    test_tensor_t dst_ts(dst_lt, eng, dst);
+
+    graph::stream_t *strm = get_stream();
+    cp.execute(strm, {src_ts.get(), gamma_ts.get()}, {dst_ts.get()});
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5);
+    }
+}
+
+TEST(test_layer_norm_execute, RMSNormAddFusion) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    std::vector<float> src {3.0, 4.0, 1.0, -1.0, 6.0, 8.0};
+    std::vector<float> gamma {1.0, 2.0};
+    std::vector<float> residual {1.0, -1.0, 0.5, 0.5, -2.0, 2.0};
+    // dst = src * gamma / sqrt(mean(src^2)) + residual
+    std::vector<float> ref_dst {
+            1.8485281, 1.2627417, 1.5, -1.5, -1.1514719, 4.2627417};
+    std::vector<float> dst(src.size(), 0.0);
+
+    graph::op_t rms_norm_op(0, graph::op_kind::RMSNorm, "rms_norm");
+    rms_norm_op.set_attr<float>(graph::op_attr::epsilon, 0);
+    graph::op_t add_op(1, graph::op_kind::Add, "add");
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t gamma_lt
+            = utils::logical_tensor_init(1, {2}, graph::data_type::f32);
+    graph::logical_tensor_t norm_dst_lt
+            = utils::logical_tensor_init(2, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t residual_lt
+            = utils::logical_tensor_init(3, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(4, {1, 3, 2}, graph::data_type::f32);
+
+    rms_norm_op.add_input(src_lt);
+    rms_norm_op.add_input(gamma_lt);
+    rms_norm_op.add_output(norm_dst_lt);
+    add_op.add_input(norm_dst_lt);
+    add_op.add_input(residual_lt);
+    add_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&rms_norm_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&add_op), graph::status::success);
+    g.finalize();
+
+    // The residual add is fused as a binary post-op of the norm.
+    graph::pass::pass_base_ptr apass
+            = get_pass("layernorm_post_ops_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &gamma_lt, &residual_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t gamma_ts(gamma_lt, eng, gamma);
+    test_tensor_t residual_ts(residual_lt, eng, residual);
+    test_tensor_t dst_ts(dst_lt, eng, dst);
+
+    ASSERT_EQ(cp.execute(strm,
+                      {src_ts.get(), gamma_ts.get(), residual_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5);
+    }
+}
+
 TEST(test_layer_norm_execute, LayerNormBackwardFp32) {
     using dims = graph::dnnl_impl::dims;
 
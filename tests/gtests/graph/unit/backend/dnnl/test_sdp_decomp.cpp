@@ -667,6 +667,467 @@ TEST(test_sdp_decomp_execute, F32SdpCorr_CPU) {
     }
 }
 
+// Test correctness of the flash attention kernel against the decomposition
+// kernel. The sequence length is not a multiple of the kernel block sizes.
+TEST(test_sdp_decomp_execute, F32SdpFlashCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    size_t ndims = 4;
+    int batch_size = 2, seq_len = 200, num_head = 4, head_dim = 256,
+        size_per_head = head_dim / num_head;
+    //query,value format tag: acbd, abcd
+    std::vector<dims> QUERY_VALUE_STRIDES = {
+            {seq_len * head_dim, size_per_head, head_dim, 1},
+            {seq_len * head_dim, size_per_head * seq_len, size_per_head, 1}};
+    //key format tag: adbc, abcd
+    std::vector<dims> KEY_STRIDES = {
+            {seq_len * head_dim, size_per_head, 1, head_dim},
+            {seq_len * head_dim, size_per_head * seq_len, size_per_head, 1}};
+    std::vector<bool> transpose_b = {false, true};
+    std::vector<bool> attention_mask_vec = {false, true};
+
+    for (size_t i = 0; i < KEY_STRIDES.size(); ++i) {
+        for (size_t j = 0; j < attention_mask_vec.size(); ++j) {
+            graph::graph_t g(eng->kind());
+            utils::construct_dnnl_float_MHA(&g, dnnl::impl::data_type::f32,
+                    batch_size, seq_len, num_head, head_dim, transpose_b[i],
+                    attention_mask_vec[j]);
+            g.finalize();
+
+            graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion_cpu");
+            apass->run(g);
+            ASSERT_EQ(g.get_num_partitions(), 1U);
+            auto part = g.get_partitions()[0];
+
+            // compile
+            graph::partition_t p;
+            p.init(part);
+
+            auto partition_inputs = p.get_inputs();
+            auto partition_outputs = p.get_outputs();
+
+            std::vector<const graph::logical_tensor_t *> inputs, outputs;
+            //mm1 src format tag: acbd, abcd
+            std::copy(QUERY_VALUE_STRIDES[i].begin(),
+                    QUERY_VALUE_STRIDES[i].begin() + ndims,
+                    partition_inputs[0].layout.strides);
+            //mm1 wei format tag: adbc, abcd
+            std::copy(KEY_STRIDES[i].begin(), KEY_STRIDES[i].begin() + ndims,
+                    partition_inputs[1].layout.strides);
+            //mm2 wei format tag: acbd, abcd
+            size_t mm2_wei_in_offset = attention_mask_vec[j] ? 4 : 3;
+            std::copy(QUERY_VALUE_STRIDES[i].begin(),
+                    QUERY_VALUE_STRIDES[i].begin() + ndims,
+                    partition_inputs[mm2_wei_in_offset].layout.strides);
+
+            for (auto &lt : partition_inputs) {
+                inputs.emplace_back(&lt);
+            }
+            for (auto &lt : partition_outputs) {
+                // set output to be strided
+                lt = utils::logical_tensor_init(
+                        lt.id, lt.data_type, graph::layout_type::strided);
+                outputs.emplace_back(&lt);
+            }
+
+            std::vector<test_tensor_t> inputs_ts;
+            for (auto &lt : inputs) {
+                inputs_ts.emplace_back(*lt, eng);
+                inputs_ts.back().fill<float>();
+            }
+
+            // -------------------------case 1----------------------------------
+            custom_setenv("_ONEDNN_GRAPH_SDPA_ENABLE_FLASH", "0", 1);
+            graph::compiled_partition_t cp1(p);
+            ASSERT_EQ(p.compile(&cp1, inputs, outputs, eng),
+                    graph::status::success);
+            std::vector<test_tensor_t> outputs1_ts;
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp1.query_logical_tensor(lt->id, &compiled_output);
+                outputs1_ts.emplace_back(compiled_output, eng);
+            }
+            ASSERT_EQ(
+                    cp1.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                            test_tensor_t::to_graph_tensor(outputs1_ts)),
+                    graph::status::success);
+            strm->wait();
+
+            // -------------------------case 2----------------------------------
+            custom_setenv("_ONEDNN_GRAPH_SDPA_ENABLE_FLASH", "1", 1);
+            graph::compiled_partition_t cp2(p);
+            ASSERT_EQ(p.compile(&cp2, inputs, outputs, eng),
+                    graph::status::success);
+            std::vector<test_tensor_t> outputs2_ts;
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp2.query_logical_tensor(lt->id, &compiled_output);
+                outputs2_ts.emplace_back(compiled_output, eng);
+            }
+            ASSERT_EQ(
+                    cp2.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                            test_tensor_t::to_graph_tensor(outputs2_ts)),
+                    graph::status::success);
+            strm->wait();
+
+            ASSERT_TRUE(allclose<float>(outputs1_ts[0], outputs2_ts[0],
+                    /*rtol*/ 0.01f,
+                    /*atol*/ 1e-6f));
+        }
+    }
+}
+
+TEST(test_sdp_decomp_execute, F32SdpFlashDecodingCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // A single query row against a long key/value sequence.
+    const dim_t batch_size = 1, num_head = 2, seq_len_q = 1,
+                seq_len_kv = 1000, head_size = 64;
+    const dims q_shape = {batch_size, num_head, seq_len_q, head_size};
+    const dims kv_shape = {batch_size, num_head, seq_len_kv, head_size};
+    const dims score_shape = {batch_size, num_head, seq_len_q, seq_len_kv};
+    const dims mask_shape = {batch_size, 1, seq_len_q, seq_len_kv};
+
+    const auto f32 = graph::data_type::f32;
+    size_t lt_id = 0;
+    auto query = utils::logical_tensor_init(lt_id++, q_shape, f32);
+    auto key = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+    auto score = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto scale = utils::logical_tensor_init(lt_id++, {1}, f32);
+    auto scaled_score = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto mask = utils::logical_tensor_init(lt_id++, mask_shape, f32);
+    auto masked_score = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto probs = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto value = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+    auto output = utils::logical_tensor_init(lt_id++, q_shape, f32);
+
+    graph::op_t matmul_qk {0, graph::op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(query);
+    matmul_qk.add_input(key);
+    matmul_qk.add_output(score);
+    graph::op_t scale_div {1, graph::op_kind::Divide, "scale_div"};
+    scale_div.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    scale_div.add_input(score);
+    scale_div.add_input(scale);
+    scale_div.add_output(scaled_score);
+    graph::op_t mask_add {2, graph::op_kind::Add, "mask_add"};
+    mask_add.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    mask_add.add_input(scaled_score);
+    mask_add.add_input(mask);
+    mask_add.add_output(masked_score);
+    graph::op_t softmax {3, graph::op_kind::SoftMax, "softmax"};
+    softmax.set_attr(graph::op_attr::axis, (int64_t)3);
+    softmax.add_input(masked_score);
+    softmax.add_output(probs);
+    graph::op_t matmul_v {4, graph::op_kind::MatMul, "matmul_v"};
+    matmul_v.add_input(probs);
+    matmul_v.add_input(value);
+    matmul_v.add_output(output);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&matmul_qk, &scale_div, &mask_add, &softmax, &matmul_v})
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    for (auto &lt : partition_outputs)
+        outputs.emplace_back(&lt);
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+
+    // The reference is the decomposition kernel. The flash kernel splits the
+    // key/value sequence into an uneven number of chunks.
+    std::vector<test_tensor_t> outputs_ts[2];
+    custom_setenv("_ONEDNN_GRAPH_SDPA_FLASH_KV_SPLITS", "3", 1);
+    for (int flash = 0; flash < 2; flash++) {
+        custom_setenv("_ONEDNN_GRAPH_SDPA_ENABLE_FLASH", flash ? "1" : "0", 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts[flash].emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts[flash])),
+                graph::status::success);
+        strm->wait();
+    }
+    custom_setenv("_ONEDNN_GRAPH_SDPA_FLASH_KV_SPLITS", "0", 1);
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0][0], outputs_ts[1][0],
+            /*rtol*/ 0.01f,
+            /*atol*/ 1e-6f));
+}
+
+TEST(test_sdp_decomp_execute, F32SdpPagedKvCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t batch_size = 2, num_head = 4, seq_len_q = 32,
+                seq_len_kv = 100, head_size = 64, block_size = 16,
+                max_num_blocks = 7, num_blocks = batch_size * max_num_blocks;
+    const dims q_shape = {batch_size, num_head, seq_len_q, head_size};
+    const dims kv_shape = {batch_size, num_head, seq_len_kv, head_size};
+    const dims score_shape = {batch_size, num_head, seq_len_q, seq_len_kv};
+    const dims cache_shape = {num_blocks, num_head, block_size, head_size};
+    const dims table_shape = {batch_size, max_num_blocks};
+
+    const auto f32 = graph::data_type::f32, s32 = graph::data_type::s32;
+    size_t lt_id = 0;
+    auto query = utils::logical_tensor_init(lt_id++, q_shape, f32);
+    auto k_cache = utils::logical_tensor_init(lt_id++, cache_shape, f32);
+    auto k_table = utils::logical_tensor_init(lt_id++, table_shape, s32);
+    auto key = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+    auto score = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto scale = utils::logical_tensor_init(lt_id++, {1}, f32);
+    auto scaled_score = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto probs = utils::logical_tensor_init(lt_id++, score_shape, f32);
+    auto v_cache = utils::logical_tensor_init(lt_id++, cache_shape, f32);
+    auto v_table = utils::logical_tensor_init(lt_id++, table_shape, s32);
+    auto value = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+    auto output = utils::logical_tensor_init(lt_id++, q_shape, f32);
+
+    graph::op_t k_load {0, graph::op_kind::PagedCacheLoad, "k_load"};
+    k_load.add_input(k_cache);
+    k_load.add_input(k_table);
+    k_load.add_output(key);
+    graph::op_t matmul_qk {1, graph::op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(query);
+    matmul_qk.add_input(key);
+    matmul_qk.add_output(score);
+    graph::op_t scale_div {2, graph::op_kind::Divide, "scale_div"};
+    scale_div.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    scale_div.add_input(score);
+    scale_div.add_input(scale);
+    scale_div.add_output(scaled_score);
+    graph::op_t softmax {3, graph::op_kind::SoftMax, "softmax"};
+    softmax.set_attr(graph::op_attr::axis, (int64_t)3);
+    softmax.add_input(scaled_score);
+    softmax.add_output(probs);
+    graph::op_t v_load {4, graph::op_kind::PagedCacheLoad, "v_load"};
+    v_load.add_input(v_cache);
+    v_load.add_input(v_table);
+    v_load.add_output(value);
+    graph::op_t matmul_v {5, graph::op_kind::MatMul, "matmul_v"};
+    matmul_v.add_input(probs);
+    matmul_v.add_input(value);
+    matmul_v.add_output(output);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&k_load, &matmul_qk, &scale_div, &softmax, &v_load,
+                 &matmul_v})
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("float_sdp_paged_kv_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 6U);
+
+    graph::partition_t p;
+    p.init(part);
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    for (auto &lt : partition_outputs)
+        outputs.emplace_back(&lt);
+
+    // Pages are assigned to the sequences in reverse order so the gather is
+    // not an identity.
+    std::vector<int32_t> table_data(batch_size * max_num_blocks);
+    for (size_t i = 0; i < table_data.size(); i++)
+        table_data[i] = static_cast<int32_t>(num_blocks - 1 - i);
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        if (lt->id == k_table.id || lt->id == v_table.id)
+            inputs_ts.back().fill<int32_t>(table_data);
+        else
+            inputs_ts.back().fill<float>();
+    }
+
+    // The reference gathers the pages with PagedCacheLoad kernels, the flash
+    // kernel reads them through the block tables.
+    std::vector<test_tensor_t> outputs_ts[2];
+    for (int flash = 0; flash < 2; flash++) {
+        custom_setenv("_ONEDNN_GRAPH_SDPA_ENABLE_FLASH", flash ? "1" : "0", 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts[flash].emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts[flash])),
+                graph::status::success);
+        strm->wait();
+    }
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0][0], outputs_ts[1][0],
+            /*rtol*/ 0.01f,
+            /*atol*/ 1e-6f));
+}
+
+TEST(test_sdp_decomp_execute, F32SdpRopeCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t batch_size = 2, num_head = 4, seq_len_q = 32,
+                seq_len_kv = 100, head_size = 64;
+    const dims q_shape = {batch_size, num_head, seq_len_q, head_size};
+    const dims kv_shape = {batch_size, num_head, seq_len_kv, head_size};
+    const dims score_shape = {batch_size, num_head, seq_len_q, seq_len_kv};
+
+    const auto f32 = graph::data_type::f32;
+    for (const std::string mode : {"rotate_half", "interleaved"}) {
+        size_t lt_id = 0;
+        auto query = utils::logical_tensor_init(lt_id++, q_shape, f32);
+        auto q_cos = utils::logical_tensor_init(
+                lt_id++, {1, 1, seq_len_q, head_size}, f32);
+        auto q_sin = utils::logical_tensor_init(
+                lt_id++, {1, 1, seq_len_q, head_size}, f32);
+        auto q_rot = utils::logical_tensor_init(lt_id++, q_shape, f32);
+        auto key = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+        auto k_cos = utils::logical_tensor_init(
+                lt_id++, {seq_len_kv, head_size}, f32);
+        auto k_sin = utils::logical_tensor_init(
+                lt_id++, {seq_len_kv, head_size}, f32);
+        auto k_rot = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+        auto score = utils::logical_tensor_init(lt_id++, score_shape, f32);
+        auto scale = utils::logical_tensor_init(lt_id++, {1}, f32);
+        auto scaled_score
+                = utils::logical_tensor_init(lt_id++, score_shape, f32);
+        auto probs = utils::logical_tensor_init(lt_id++, score_shape, f32);
+        auto value = utils::logical_tensor_init(lt_id++, kv_shape, f32);
+        auto output = utils::logical_tensor_init(lt_id++, q_shape, f32);
+
+        graph::op_t q_rope {0, graph::op_kind::RoPE, "q_rope"};
+        q_rope.set_attr(graph::op_attr::mode, mode);
+        q_rope.add_input(query);
+        q_rope.add_input(q_cos);
+        q_rope.add_input(q_sin);
+        q_rope.add_output(q_rot);
+        graph::op_t k_rope {1, graph::op_kind::RoPE, "k_rope"};
+        k_rope.set_attr(graph::op_attr::mode, mode);
+        k_rope.add_input(key);
+        k_rope.add_input(k_cos);
+        k_rope.add_input(k_sin);
+        k_rope.add_output(k_rot);
+        graph::op_t matmul_qk {2, graph::op_kind::MatMul, "matmul_qk"};
+        matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+        matmul_qk.add_input(q_rot);
+        matmul_qk.add_input(k_rot);
+        matmul_qk.add_output(score);
+        graph::op_t scale_div {3, graph::op_kind::Divide, "scale_div"};
+        scale_div.set_attr(
+                graph::op_attr::auto_broadcast, std::string("numpy"));
+        scale_div.add_input(score);
+        scale_div.add_input(scale);
+        scale_div.add_output(scaled_score);
+        graph::op_t softmax {4, graph::op_kind::SoftMax, "softmax"};
+        softmax.set_attr(graph::op_attr::axis, (int64_t)3);
+        softmax.add_input(scaled_score);
+        softmax.add_output(probs);
+        graph::op_t matmul_v {5, graph::op_kind::MatMul, "matmul_v"};
+        matmul_v.add_input(probs);
+        matmul_v.add_input(value);
+        matmul_v.add_output(output);
+
+        graph::graph_t g(eng->kind());
+        for (auto *op : {&q_rope, &k_rope, &matmul_qk, &scale_div, &softmax,
+                     &matmul_v})
+            ASSERT_EQ(g.add_op(op), graph::status::success);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("float_sdp_rope_fusion_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+        ASSERT_EQ(part->get_ops().size(), 6U);
+
+        graph::partition_t p;
+        p.init(part);
+        auto partition_inputs = p.get_inputs();
+        auto partition_outputs = p.get_outputs();
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        for (auto &lt : partition_inputs)
+            inputs.emplace_back(&lt);
+        for (auto &lt : partition_outputs)
+            outputs.emplace_back(&lt);
+
+        std::vector<test_tensor_t> inputs_ts;
+        for (auto &lt : inputs) {
+            inputs_ts.emplace_back(*lt, eng);
+            inputs_ts.back().fill<float>();
+        }
+
+        // The reference runs the RoPE kernels before the matmuls, the flash
+        // kernel rotates the query and key tiles while loading them.
+        std::vector<test_tensor_t> outputs_ts[2];
+        for (int flash = 0; flash < 2; flash++) {
+            custom_setenv(
+                    "_ONEDNN_GRAPH_SDPA_ENABLE_FLASH", flash ? "1" : "0", 1);
+            graph::compiled_partition_t cp(p);
+            ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                    graph::status::success);
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp.query_logical_tensor(lt->id, &compiled_output);
+                outputs_ts[flash].emplace_back(compiled_output, eng);
+            }
+            ASSERT_EQ(cp.execute(strm,
+                              test_tensor_t::to_graph_tensor(inputs_ts),
+                              test_tensor_t::to_graph_tensor(
+                                      outputs_ts[flash])),
+                    graph::status::success);
+            strm->wait();
+        }
+
+        ASSERT_TRUE(allclose<float>(outputs_ts[0][0], outputs_ts[1][0],
+                /*rtol*/ 0.01f,
+                /*atol*/ 1e-6f));
+    }
+}
+
 // Test correctness
 TEST(test_sdp_decomp_execute, F32DistilBertSdpCorr_CPU) {
     graph::engine_t *eng = get_engine();
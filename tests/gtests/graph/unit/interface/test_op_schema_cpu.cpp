@@ -5153,3 +5153,82 @@ TEST(test_interface_op_schema, InferPowOutputShape) {
 
     verify_single_in_identity_shape_infer(op_kind_);
 }
+
+TEST(test_interface_op_schema, InferPagedCacheLoadOutputShape) {
+    const op_schema_t *op_schema
+            = op_schema_registry_t::get_op_schema(op_kind::PagedCacheLoad);
+    op_t op {op_kind::PagedCacheLoad, op_t::kind2str(op_kind::PagedCacheLoad)};
+
+    // cache: [num_blocks, num_head, block_size, head_size]
+    logical_tensor_t lt_cache
+            = logical_tensor_init(0, {16, 4, 32, 64}, data_type::f32);
+    // block_table: [batch_size, max_num_blocks_per_seq]
+    logical_tensor_t lt_table = logical_tensor_init(1, {2, 8}, data_type::s32);
+    std::vector<logical_tensor_t *> lt_in {&lt_cache, &lt_table};
+
+    // the sequence length defaults to the capacity of the block table
+    logical_tensor_t lt_o1
+            = logical_tensor_init(2, data_type::f32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_out1 {&lt_o1};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in, lt_out1), status::success);
+    const std::vector<int64_t> expected_out_shape1 = {2, 4, 256, 64};
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_o1).vdims(), expected_out_shape1);
+
+    // a shorter sequence length given by the user is kept
+    logical_tensor_t lt_o2
+            = logical_tensor_init(2, {2, 4, 200, 64}, data_type::f32);
+    std::vector<logical_tensor_t *> lt_out2 {&lt_o2};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in, lt_out2), status::success);
+    const std::vector<int64_t> expected_out_shape2 = {2, 4, 200, 64};
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_o2).vdims(), expected_out_shape2);
+
+    // the sequence length can't exceed the capacity of the block table
+    logical_tensor_t lt_o3
+            = logical_tensor_init(2, {2, 4, 300, 64}, data_type::f32);
+    std::vector<logical_tensor_t *> lt_out3 {&lt_o3};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in, lt_out3),
+            status::invalid_shape);
+}
+
+TEST(test_interface_op_schema, InferRMSNormOutputShape) {
+    const op_kind_t op_kind_ = op_kind::RMSNorm;
+
+    verify_single_in_identity_shape_infer(op_kind_);
+}
+
+TEST(test_interface_op_schema, InferRoPEOutputShape) {
+    const op_schema_t *op_schema
+            = op_schema_registry_t::get_op_schema(op_kind::RoPE);
+    op_t op {op_kind::RoPE, op_t::kind2str(op_kind::RoPE)};
+
+    logical_tensor_t lt_src
+            = logical_tensor_init(0, {2, 4, 32, 64}, data_type::f32);
+    // cos and sin are broadcast over the batch and the heads
+    logical_tensor_t lt_cos = logical_tensor_init(1, {32, 64}, data_type::f32);
+    logical_tensor_t lt_sin
+            = logical_tensor_init(2, {1, 1, 32, 64}, data_type::f32);
+    std::vector<logical_tensor_t *> lt_in {&lt_src, &lt_cos, &lt_sin};
+    logical_tensor_t lt_o
+            = logical_tensor_init(3, data_type::f32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_out {&lt_o};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in, lt_out), status::success);
+    const std::vector<int64_t> expected_out_shape = {2, 4, 32, 64};
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_o).vdims(), expected_out_shape);
+
+    // sin doesn't cover the last dimension
+    logical_tensor_t lt_sin_half
+            = logical_tensor_init(2, {1, 1, 32, 32}, data_type::f32);
+    std::vector<logical_tensor_t *> lt_in_half {&lt_src, &lt_cos, &lt_sin_half};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in_half, lt_out),
+            status::invalid_shape);
+
+    // the last dimension of src should be even
+    logical_tensor_t lt_src_odd
+            = logical_tensor_init(0, {2, 4, 32, 63}, data_type::f32);
+    logical_tensor_t lt_cos_odd
+            = logical_tensor_init(1, {32, 63}, data_type::f32);
+    std::vector<logical_tensor_t *> lt_in_odd {
+            &lt_src_odd, &lt_cos_odd, &lt_cos_odd};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in_odd, lt_out),
+            status::invalid_shape);
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/cache_utils.hpp"
+
+namespace {
+
+struct test_key_t {
+    test_key_t(int id) : id(id), tid(std::this_thread::get_id()) {}
+
+    bool operator==(const test_key_t &other) const { return id == other.id; }
+    std::thread::id thread_id() const { return tid; }
+    bool has_runtime_dependencies() const { return false; }
+
+    int id;
+    std::thread::id tid;
+};
+
+struct test_object_t {
+    size_t size;
+};
+
+struct test_result_t {
+    test_result_t() : status(dnnl::impl::status::success) {}
+    test_result_t(std::shared_ptr<test_object_t> o, dnnl::impl::status_t s)
+        : value(std::move(o)), status(s) {}
+    bool is_empty() const { return value == nullptr; }
+    const test_object_t &get_value() const { return *value; }
+    std::shared_ptr<test_object_t> value;
+    dnnl::impl::status_t status;
+};
+
+size_t test_object_size(const test_object_t &o) {
+    return o.size;
+}
+
+// The context is the size of the object to create.
+test_result_t create_test_object(void *context) {
+    const size_t size = *static_cast<size_t *>(context);
+    return {std::make_shared<test_object_t>(test_object_t {size}),
+            dnnl::impl::status::success};
+}
+
+using test_cache_t = dnnl::impl::utils::lru_cache_t<test_key_t, test_object_t,
+        test_result_t, nullptr, test_object_size>;
+
+} // namespace
+
+namespace std {
+template <>
+struct hash<test_key_t> {
+    size_t operator()(const test_key_t &key) const {
+        return std::hash<int>()(key.id);
+    }
+};
+} // namespace std
+
+namespace dnnl {
+
+TEST(lru_cache_test, TestSizeInBytesOnUpdate) {
+    test_cache_t cache(/* capacity = */ 8);
+    const test_key_t key(1);
+
+    size_t size = 100;
+    cache.get_or_create(key, create_test_object, &size, false);
+    ASSERT_EQ(cache.get_size(), 1);
+    ASSERT_EQ(cache.get_size_in_bytes(), 100u);
+
+    // Forced creation updates the existing entry, which must replace its
+    // size rather than add to it.
+    size = 60;
+    cache.get_or_create(key, create_test_object, &size, true);
+    ASSERT_EQ(cache.get_size(), 1);
+    ASSERT_EQ(cache.get_size_in_bytes(), 60u);
+
+    size = 60;
+    cache.get_or_create(key, create_test_object, &size, true);
+    ASSERT_EQ(cache.get_size(), 1);
+    ASSERT_EQ(cache.get_size_in_bytes(), 60u);
+
+    ASSERT_EQ(cache.set_capacity(0), dnnl::impl::status::success);
+    ASSERT_EQ(cache.get_size(), 0);
+    ASSERT_EQ(cache.get_size_in_bytes(), 0u);
+}
+
+TEST(lru_cache_test, TestEvictionInBytes) {
+    test_cache_t cache(/* capacity = */ 8, /* nshards = */ 2);
+    ASSERT_EQ(cache.set_capacity_in_bytes(150), dnnl::impl::status::success);
+
+    size_t size = 100;
+    for (int id = 0; id < 3; id++)
+        cache.get_or_create({id}, create_test_object, &size, false);
+
+    // Only the most recent entry fits the capacity.
+    ASSERT_EQ(cache.get_size(), 1);
+    ASSERT_EQ(cache.get_size_in_bytes(), 100u);
+    ASSERT_TRUE(cache.get({2}).value != nullptr);
+    ASSERT_TRUE(cache.get({0}).value == nullptr);
+}
+
+} // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2021 Intel Corporation
+* Copyright 2018-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
+#include "src/common/native_threadpool.hpp"
+
 namespace dnnl {
 
 TEST(test_parallel, Test) {
@@ -29,6 +32,87 @@ TEST(test_parallel, Test) {
     });
 }
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+TEST(test_parallel, NestedWithThreadBudget) {
+    const int n_outer = 2, budget = 2;
+    const int max_active_levels = omp_get_max_active_levels();
+    if (max_active_levels < 2) omp_set_max_active_levels(2);
+    if (omp_get_max_active_levels() < 2) return; // nesting is not supported
+
+    std::vector<int> nthr_default(n_outer, 0), max_threads(n_outer, 0);
+    std::vector<int> nthr_seen(n_outer, 0), nthr_nested(n_outer, 0);
+    std::vector<int> in_parallel(n_outer, 0);
+#pragma omp parallel num_threads(n_outer)
+    {
+        const int outer = omp_get_thread_num();
+        // Without a budget, nested sections run sequentially.
+        nthr_default[outer] = dnnl_get_current_num_threads();
+
+        impl::set_thread_budget(budget);
+        max_threads[outer] = dnnl_get_max_threads();
+        in_parallel[outer] = dnnl_in_parallel();
+        impl::parallel(0, [&](int ithr, int nthr) {
+            if (ithr != 0) return;
+            nthr_seen[outer] = nthr;
+            // The budget is not inherited by the nested team.
+            nthr_nested[outer] = dnnl_get_current_num_threads();
+        });
+        impl::set_thread_budget(0);
+    }
+    omp_set_max_active_levels(max_active_levels);
+
+    for (int outer = 0; outer < n_outer; outer++) {
+        ASSERT_EQ(nthr_default[outer], 1);
+        ASSERT_EQ(max_threads[outer], budget);
+        // A budget does not hide the application parallel region.
+        ASSERT_TRUE(in_parallel[outer]);
+        ASSERT_EQ(nthr_seen[outer], budget);
+        ASSERT_EQ(nthr_nested[outer], 1);
+    }
+}
+#endif
+
+TEST(test_parallel, ThreadBudgetApi) {
+    int max_threads = -1;
+    ASSERT_EQ(dnnl_get_thread_budget(&max_threads), dnnl_success);
+    ASSERT_EQ(max_threads, 0);
+    ASSERT_EQ(dnnl_set_thread_budget(3), dnnl_success);
+    ASSERT_EQ(dnnl_get_thread_budget(&max_threads), dnnl_success);
+    ASSERT_EQ(max_threads, 3);
+    ASSERT_EQ(dnnl_set_thread_budget(-1), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_get_thread_budget(nullptr), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_set_thread_budget(0), dnnl_success);
+}
+
+TEST(test_parallel, StreamThreadBudget) {
+    const int default_nthr = dnnl_get_max_threads();
+    const int thread_budget = 1;
+
+    // The budget of the thread is seen outside of executions, e.g. at
+    // primitive creation.
+    impl::set_thread_budget(thread_budget);
+    ASSERT_EQ(dnnl_get_max_threads(), 1);
+
+    // A stream without a budget keeps the budget of the thread.
+    impl::apply_stream_thread_budget(0);
+    ASSERT_EQ(impl::get_thread_budget(), thread_budget);
+    impl::restore_thread_budget();
+
+    // A stream budget overrides the budget of the thread, nested executions
+    // keep the outermost one.
+    impl::apply_stream_thread_budget(2);
+    ASSERT_EQ(impl::get_thread_budget(), 2);
+    impl::apply_stream_thread_budget(3);
+    ASSERT_EQ(impl::get_thread_budget(), 2);
+    impl::restore_thread_budget();
+    ASSERT_EQ(impl::get_thread_budget(), 2);
+    impl::restore_thread_budget();
+    ASSERT_EQ(impl::get_thread_budget(), thread_budget);
+
+    impl::set_thread_budget(0);
+    ASSERT_EQ(dnnl_get_max_threads(), default_nthr);
+}
+
 using data_t = ptrdiff_t;
 
 struct nd_params_t {
@@ -160,4 +244,50 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+TEST(test_native_threadpool, EachIterationOnce) {
+    impl::native_threadpool_t tp(4, false, 16);
+    ASSERT_EQ(tp.get_num_threads(), 4);
+    ASSERT_FALSE(tp.get_in_parallel());
+
+    for (int n : {0, 1, 3, 4, 17, 1000}) {
+        for (int iter = 0; iter < 50; iter++) {
+            std::vector<std::atomic<int>> hits(n);
+            for (auto &h : hits)
+                h = 0;
+            tp.parallel_for(n, [&](int i, int nn) {
+                ASSERT_EQ(nn, n);
+                ASSERT_TRUE(tp.get_in_parallel());
+                hits[i]++;
+            });
+            for (int i = 0; i < n; i++)
+                ASSERT_EQ(hits[i].load(), 1);
+        }
+    }
+}
+
+TEST(test_native_threadpool, NestedRunsInline) {
+    impl::native_threadpool_t tp(4, false, 16);
+    const int n_outer = 8, n_inner = 16;
+    std::atomic<int> total {0};
+    tp.parallel_for(n_outer, [&](int, int) {
+        tp.parallel_for(n_inner, [&](int, int) { total++; });
+    });
+    ASSERT_EQ(total.load(), n_outer * n_inner);
+}
+
+TEST(test_native_threadpool, ConcurrentSubmitters) {
+    impl::native_threadpool_t tp(4, false, 16);
+    const int n_submitters = 4, n_iters = 100, n = 64;
+    std::atomic<int> total {0};
+    std::vector<std::thread> submitters;
+    for (int s = 0; s < n_submitters; s++)
+        submitters.emplace_back([&]() {
+            for (int iter = 0; iter < n_iters; iter++)
+                tp.parallel_for(n, [&](int, int) { total++; });
+        });
+    for (auto &s : submitters)
+        s.join();
+    ASSERT_EQ(total.load(), n_submitters * n_iters * n);
+}
+
 } // namespace dnnl
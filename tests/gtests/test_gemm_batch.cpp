@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+
+struct gemm_batch_params_t {
+    char transa;
+    char transb;
+    dnnl_dim_t M, N, K;
+    dnnl_dim_t batch;
+    float alpha, beta;
+};
+
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_params_t> {
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<decltype(p)>::GetParam();
+        const bool is_trans_a = p.transa == 'T' || p.transa == 't';
+        const bool is_trans_b = p.transb == 'T' || p.transb == 't';
+        // Row-major leading dimensions with some padding.
+        lda = (is_trans_a ? p.M : p.K) + 3;
+        ldb = (is_trans_b ? p.K : p.N) + 1;
+        ldc = p.N + 2;
+        stride_a = (is_trans_a ? p.K : p.M) * lda;
+        stride_b = (is_trans_b ? p.N : p.K) * ldb;
+        stride_c = p.M * ldc;
+    }
+
+    template <typename T>
+    static void fill(std::vector<T> &v, int mod, int shift) {
+        for (size_t i = 0; i < v.size(); i++)
+            v[i] = static_cast<T>((int)((i * 7 + 3) % mod) - shift);
+    }
+
+    gemm_batch_params_t p;
+    dnnl_dim_t lda, ldb, ldc;
+    dnnl_dim_t stride_a, stride_b, stride_c;
+};
+
+// The batched functions may run a problem with a different number of threads
+// than the per-problem calls do, hence f32 results are compared with a small
+// tolerance.
+void check_f32(const std::vector<float> &C, const std::vector<float> &C_ref) {
+    ASSERT_EQ(C.size(), C_ref.size());
+    for (size_t i = 0; i < C.size(); i++)
+        ASSERT_NEAR(C[i], C_ref[i], 1e-5f * std::max(1.f, std::abs(C_ref[i])));
+}
+
+TEST_P(gemm_batch_test_t, TestF32) {
+    std::vector<float> A(p.batch * stride_a), B(p.batch * stride_b);
+    std::vector<float> C(p.batch * stride_c), C_ref;
+    fill(A, 13, 6);
+    fill(B, 11, 5);
+    fill(C, 5, 2);
+    C_ref = C;
+
+    std::vector<const float *> A_ptrs, B_ptrs;
+    std::vector<float *> C_ptrs;
+    for (dnnl_dim_t i = 0; i < p.batch; i++) {
+        A_ptrs.push_back(A.data() + i * stride_a);
+        B_ptrs.push_back(B.data() + i * stride_b);
+        C_ptrs.push_back(C.data() + i * stride_c);
+        ASSERT_EQ(dnnl_sgemm(p.transa, p.transb, p.M, p.N, p.K, p.alpha,
+                          A_ptrs.back(), lda, B_ptrs.back(), ldb, p.beta,
+                          C_ref.data() + i * stride_c, ldc),
+                dnnl_success);
+    }
+
+    const auto C_init = C;
+    ASSERT_EQ(dnnl_sgemm_batch(p.transa, p.transb, p.M, p.N, p.K, p.alpha,
+                      A_ptrs.data(), lda, B_ptrs.data(), ldb, p.beta,
+                      C_ptrs.data(), ldc, p.batch),
+            dnnl_success);
+    check_f32(C, C_ref);
+
+    C = C_init;
+    ASSERT_EQ(dnnl_sgemm_strided_batch(p.transa, p.transb, p.M, p.N, p.K,
+                      p.alpha, A.data(), lda, stride_a, B.data(), ldb, stride_b,
+                      p.beta, C.data(), ldc, stride_c, p.batch),
+            dnnl_success);
+    check_f32(C, C_ref);
+}
+
+TEST_P(gemm_batch_test_t, TestU8S8S32) {
+    std::vector<uint8_t> A(p.batch * stride_a);
+    std::vector<int8_t> B(p.batch * stride_b);
+    std::vector<int32_t> C(p.batch * stride_c), C_ref;
+    fill(A, 29, 0);
+    fill(B, 23, 11);
+    fill(C, 5, 2);
+    C_ref = C;
+    const uint8_t ao = 3;
+    const int8_t bo = -2;
+    const std::vector<int32_t> co(p.N, 7);
+
+    std::vector<const uint8_t *> A_ptrs;
+    std::vector<const int8_t *> B_ptrs;
+    std::vector<int32_t *> C_ptrs;
+    for (dnnl_dim_t i = 0; i < p.batch; i++) {
+        A_ptrs.push_back(A.data() + i * stride_a);
+        B_ptrs.push_back(B.data() + i * stride_b);
+        C_ptrs.push_back(C.data() + i * stride_c);
+        ASSERT_EQ(dnnl_gemm_u8s8s32(p.transa, p.transb, 'R', p.M, p.N, p.K,
+                          p.alpha, A_ptrs.back(), lda, ao, B_ptrs.back(), ldb,
+                          bo, p.beta, C_ref.data() + i * stride_c, ldc,
+                          co.data()),
+                dnnl_success);
+    }
+
+    const auto C_init = C;
+    ASSERT_EQ(dnnl_gemm_u8s8s32_batch(p.transa, p.transb, 'R', p.M, p.N, p.K,
+                      p.alpha, A_ptrs.data(), lda, ao, B_ptrs.data(), ldb, bo,
+                      p.beta, C_ptrs.data(), ldc, co.data(), p.batch),
+            dnnl_success);
+    ASSERT_EQ(C, C_ref);
+
+    C = C_init;
+    ASSERT_EQ(dnnl_gemm_u8s8s32_strided_batch(p.transa, p.transb, 'R', p.M,
+                      p.N, p.K, p.alpha, A.data(), lda, stride_a, ao, B.data(),
+                      ldb, stride_b, bo, p.beta, C.data(), ldc, stride_c,
+                      co.data(), p.batch),
+            dnnl_success);
+    ASSERT_EQ(C, C_ref);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(gemm_batch_params_t {'N', 'N', 16, 16, 16, 8, 1, 0},
+                gemm_batch_params_t {'N', 'T', 7, 33, 64, 12, 1, 1},
+                gemm_batch_params_t {'T', 'N', 65, 17, 9, 3, 2, 0},
+                gemm_batch_params_t {'T', 'T', 128, 96, 80, 5, 1, 0.5f},
+                gemm_batch_params_t {'N', 'N', 10, 10, 10, 0, 1, 0}));
+
+TEST(gemm_batch_test_t, TestInvalidArguments) {
+    const dnnl_dim_t n = 4;
+    std::vector<float> A(n * n), B(n * n), C(n * n);
+    const float *A_ptrs[] = {A.data()};
+    const float *B_ptrs[] = {B.data()};
+    float *C_ptrs[] = {C.data()};
+
+    ASSERT_EQ(dnnl_sgemm_batch('N', 'N', n, n, n, 1.f, A_ptrs, n, B_ptrs, n,
+                      0.f, C_ptrs, n, -1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch('N', 'N', n, n, n, 1.f, nullptr, n, B_ptrs, n,
+                      0.f, C_ptrs, n, 1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch('N', 'N', n, n, n, 1.f, A_ptrs, n, B_ptrs, n,
+                      0.f, C_ptrs, n - 1, 1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_strided_batch('N', 'N', n, n, n, 1.f, A.data(), n, 0,
+                      B.data(), n, 0, 0.f, C.data(), n, -1, 1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_gemm_u8s8s32_strided_batch('N', 'N', 'X', n, n, n, 1.f,
+                      nullptr, n, 0, 0, nullptr, n, 0, 0, 0.f, nullptr, n, 0,
+                      nullptr, 1),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
@@ -0,0 +1,203 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+
+// Packed buffers must be aligned to 64 bytes.
+struct pack_buffer_t {
+    pack_buffer_t(size_t size) : storage(size + 64) {}
+    char *data() {
+        const auto addr = reinterpret_cast<uintptr_t>(storage.data());
+        return storage.data() + (64 - addr % 64) % 64;
+    }
+    std::vector<char> storage;
+};
+
+struct gemm_pack_params_t {
+    char transa;
+    char transb;
+    dnnl_dim_t M, N, K;
+    float beta;
+};
+
+class gemm_pack_test_t : public ::testing::TestWithParam<gemm_pack_params_t> {
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<decltype(p)>::GetParam();
+        const bool is_trans_a = p.transa == 'T' || p.transa == 't';
+        const bool is_trans_b = p.transb == 'T' || p.transb == 't';
+        lda = (is_trans_a ? p.M : p.K) + 5;
+        ldb = (is_trans_b ? p.K : p.N) + 2;
+        ldc = p.N + 1;
+        a_size = (is_trans_a ? p.K : p.M) * lda;
+        b_size = (is_trans_b ? p.N : p.K) * ldb;
+        c_size = p.M * ldc;
+    }
+
+    template <typename T>
+    static void fill(std::vector<T> &v, int mod, int shift) {
+        for (size_t i = 0; i < v.size(); i++)
+            v[i] = static_cast<T>((int)((i * 5 + 1) % mod) - shift);
+    }
+
+    gemm_pack_params_t p;
+    dnnl_dim_t lda, ldb, ldc;
+    dnnl_dim_t a_size, b_size, c_size;
+};
+
+TEST_P(gemm_pack_test_t, TestF32) {
+    std::vector<float> A(a_size), B(b_size), C(c_size), C_ref;
+    fill(A, 13, 6);
+    fill(B, 11, 5);
+    fill(C, 5, 2);
+    C_ref = C;
+    ASSERT_EQ(dnnl_sgemm(p.transa, p.transb, p.M, p.N, p.K, 1.f, A.data(),
+                      lda, B.data(), ldb, p.beta, C_ref.data(), ldc),
+            dnnl_success);
+
+    for (char identifier : {'A', 'B'}) {
+        const bool pack_a = identifier == 'A';
+        size_t size = 0;
+        dnnl_status_t st = dnnl_sgemm_pack_get_size(identifier, p.transa,
+                p.transb, p.M, p.N, p.K, lda, ldb, &size);
+        if (st == dnnl_unimplemented) return;
+        ASSERT_EQ(st, dnnl_success);
+
+        pack_buffer_t packed(size);
+        ASSERT_EQ(dnnl_sgemm_pack(identifier, p.transa, p.transb, p.M, p.N,
+                          p.K, lda, ldb, pack_a ? A.data() : B.data(),
+                          packed.data()),
+                dnnl_success);
+
+        // A packed matrix is reused by several multiplies.
+        for (int iter = 0; iter < 2; iter++) {
+            std::vector<float> C_test = C;
+            ASSERT_EQ(dnnl_sgemm_compute(pack_a ? 'P' : p.transa,
+                              pack_a ? p.transb : 'P', p.M, p.N, p.K,
+                              pack_a ? (const void *)packed.data() : A.data(),
+                              lda,
+                              pack_a ? (const void *)B.data() : packed.data(),
+                              ldb, p.beta, C_test.data(), ldc),
+                    dnnl_success);
+            for (size_t i = 0; i < C_test.size(); i++)
+                ASSERT_NEAR(C_test[i], C_ref[i],
+                        1e-5f * std::max(1.f, std::abs(C_ref[i])));
+        }
+    }
+}
+
+TEST_P(gemm_pack_test_t, TestU8S8S32) {
+    std::vector<uint8_t> A(a_size);
+    std::vector<int8_t> B(b_size);
+    std::vector<int32_t> C(c_size), C_ref;
+    fill(A, 29, 0);
+    fill(B, 23, 11);
+    fill(C, 5, 2);
+    C_ref = C;
+    const std::vector<int32_t> co(p.N, 3);
+    ASSERT_EQ(dnnl_gemm_u8s8s32(p.transa, p.transb, 'R', p.M, p.N, p.K, 1.f,
+                      A.data(), lda, 0, B.data(), ldb, 0, p.beta, C_ref.data(),
+                      ldc, co.data()),
+            dnnl_success);
+
+    for (char identifier : {'A', 'B'}) {
+        const bool pack_a = identifier == 'A';
+        size_t size = 0;
+        dnnl_status_t st = dnnl_gemm_u8s8s32_pack_get_size(identifier,
+                p.transa, p.transb, p.M, p.N, p.K, lda, ldb, &size);
+        if (st == dnnl_unimplemented) return;
+        ASSERT_EQ(st, dnnl_success);
+
+        pack_buffer_t packed(size);
+        ASSERT_EQ(dnnl_gemm_u8s8s32_pack(identifier, p.transa, p.transb, p.M,
+                          p.N, p.K, lda, ldb,
+                          pack_a ? (const void *)A.data() : B.data(),
+                          packed.data()),
+                dnnl_success);
+
+        std::vector<int32_t> C_test = C;
+        ASSERT_EQ(dnnl_gemm_u8s8s32_compute(pack_a ? 'P' : p.transa,
+                          pack_a ? p.transb : 'P', 'R', p.M, p.N, p.K,
+                          pack_a ? (const void *)packed.data() : A.data(), lda,
+                          pack_a ? (const void *)B.data() : packed.data(), ldb,
+                          p.beta, C_test.data(), ldc, co.data()),
+                dnnl_success);
+        ASSERT_EQ(C_test, C_ref);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmPack, gemm_pack_test_t,
+        ::testing::Values(gemm_pack_params_t {'N', 'N', 30, 20, 10, 0},
+                gemm_pack_params_t {'N', 'T', 64, 128, 256, 1},
+                gemm_pack_params_t {'T', 'N', 1, 300, 100, 0},
+                gemm_pack_params_t {'T', 'T', 200, 50, 33, 0.5f}));
+
+TEST(gemm_pack_test_t, TestMismatchedBuffer) {
+    const dnnl_dim_t M = 16, N = 32, K = 8;
+    std::vector<float> A(M * K, 1.f), B(K * N, 1.f), C(M * N);
+
+    size_t size = 0;
+    dnnl_status_t st
+            = dnnl_sgemm_pack_get_size('B', 'N', 'N', M, N, K, K, N, &size);
+    if (st == dnnl_unimplemented) return;
+    ASSERT_EQ(st, dnnl_success);
+    pack_buffer_t packed(size);
+    ASSERT_EQ(dnnl_sgemm_pack('B', 'N', 'N', M, N, K, K, N, B.data(),
+                      packed.data()),
+            dnnl_success);
+
+    // Sizes or matrix different from the packed ones.
+    ASSERT_EQ(dnnl_sgemm_compute('N', 'P', M, N, K + 1, A.data(), K + 1,
+                      packed.data(), N, 0.f, C.data(), N),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_compute('P', 'N', M, N, K, packed.data(), K,
+                      B.data(), N, 0.f, C.data(), N),
+            dnnl_invalid_arguments);
+    // A buffer packed for another GEMM flavor.
+    ASSERT_EQ(dnnl_gemm_u8s8s32_compute('N', 'P', 'F', M, N, K, A.data(), K,
+                      packed.data(), N, 0.f, (int32_t *)C.data(), N, nullptr),
+            dnnl_invalid_arguments);
+    // A corrupted header.
+    pack_buffer_t corrupted(size);
+    std::copy(packed.data(), packed.data() + size, corrupted.data());
+    corrupted.data()[0] ^= 1;
+    ASSERT_EQ(dnnl_sgemm_compute('N', 'P', M, N, K, A.data(), K,
+                      corrupted.data(), N, 0.f, C.data(), N),
+            dnnl_invalid_arguments);
+
+    // A misaligned buffer.
+    ASSERT_EQ(dnnl_sgemm_pack('B', 'N', 'N', M, N, K, K, N, B.data(),
+                      corrupted.data() + 4),
+            dnnl_invalid_arguments);
+
+    ASSERT_EQ(dnnl_sgemm_compute('N', 'P', M, N, K, A.data(), K,
+                      packed.data(), N, 0.f, C.data(), N),
+            dnnl_success);
+    for (float c : C)
+        ASSERT_EQ(c, (float)K);
+}
+
+} // namespace dnnl
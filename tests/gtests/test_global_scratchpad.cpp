@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2022 Intel Corporation
+* Copyright 2020-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,10 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/scratchpad.hpp"
 
 namespace dnnl {
 
@@ -103,4 +108,118 @@ HANDLE_EXCEPTIONS_FOR_TEST(global_scratchpad_t, TestGlobalScratchpad) {
     // if something goes wrong, test should return 139 on Linux.
 };
 
+HANDLE_EXCEPTIONS_FOR_TEST(global_scratchpad_t, TestArenaStats) {
+    engine eng(engine::kind::cpu, 0);
+    auto create = [&](size_t size) {
+        return std::unique_ptr<impl::scratchpad_t>(
+                impl::create_scratchpad(eng.get(), size, false));
+    };
+    const size_t mb = 1024 * 1024;
+
+    // Drop the buffers kept by the previous tests.
+    impl::set_scratchpad_arena_capacity(0);
+    impl::set_scratchpad_arena_capacity(64 * mb);
+
+    impl::scratchpad_arena_stats_t before, after;
+    ASSERT_EQ(impl::get_scratchpad_arena_stats(&before), impl::status::success);
+    ASSERT_EQ(before.cached_bytes, 0u);
+
+    create(mb); // miss, the buffer is kept
+    {
+        auto s0 = create(mb); // hit
+        auto s1 = create(mb); // miss
+    }
+    {
+        auto s0 = create(4 * mb); // miss, the kept buffers are too small
+        auto s1 = create(3 * mb / 4); // hit, a 1 MB buffer fits
+    }
+
+    ASSERT_EQ(impl::get_scratchpad_arena_stats(&after), impl::status::success);
+    ASSERT_EQ(after.hits - before.hits, 2u);
+    ASSERT_EQ(after.misses - before.misses, 3u);
+    ASSERT_EQ(after.reused_bytes - before.reused_bytes, 2 * mb);
+    ASSERT_EQ(after.cached_bytes, 6 * mb);
+    ASSERT_GE(after.peak_bytes, 6 * mb);
+
+    // Buffers that do not fit the new capacity are freed.
+    impl::set_scratchpad_arena_capacity(mb);
+    ASSERT_EQ(impl::get_scratchpad_arena_stats(&after), impl::status::success);
+    ASSERT_LE(after.cached_bytes, mb);
+    impl::set_scratchpad_arena_capacity(0);
+    ASSERT_EQ(impl::get_scratchpad_arena_stats(&after), impl::status::success);
+    ASSERT_EQ(after.cached_bytes, 0u);
+}
+
+// Several application threads execute the same primitive, each on its own
+// stream. Every execution borrows a scratchpad from the pool of its stream.
+HANDLE_EXCEPTIONS_FOR_TEST(global_scratchpad_t, TestConcurrentStreams) {
+    engine eng(engine::kind::cpu, 0);
+    SKIP_IF(!impl::use_scratchpad_pool(eng.get()),
+            "Scratchpads are not borrowed from streams in this build.");
+
+    const memory::dims src_dims = {2, 8, 14, 14}, wei_dims = {16, 8, 3, 3},
+                       dst_dims = {2, 16, 14, 14};
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            {src_dims, dt::f32, tag::nchw}, {wei_dims, dt::f32, tag::oihw},
+            {dst_dims, dt::f32, tag::nchw}, {1, 1}, {1, 1}, {1, 1});
+    auto prim = convolution_forward(pd);
+
+    // Multiples of 1/8 make every accumulation order produce the same result.
+    auto fill = [](const memory &mem) {
+        auto *ptr = static_cast<float *>(mem.get_data_handle());
+        const size_t nelems = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = static_cast<float>((int)(i % 13) - 6) / 8.f;
+    };
+    auto src = test::make_memory(pd.src_desc(), eng);
+    auto wei = test::make_memory(pd.weights_desc(), eng);
+    fill(src);
+    fill(wei);
+
+    const int n_streams = 4, n_iters = 10;
+    std::vector<stream> streams;
+    std::vector<memory> dsts;
+    for (int i = 0; i < n_streams; i++) {
+        streams.push_back(make_stream(eng));
+        dsts.push_back(test::make_memory(pd.dst_desc(), eng));
+    }
+    auto execute = [&](int i) {
+        prim.execute(streams[i],
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dsts[i]}});
+        streams[i].wait();
+    };
+
+    // The first execution on each stream fills its pool.
+    for (int i = 0; i < n_streams; i++)
+        execute(i);
+    const size_t nelems = pd.dst_desc().get_size() / sizeof(float);
+    const auto *ref_ptr = static_cast<const float *>(dsts[0].get_data_handle());
+    const std::vector<float> ref(ref_ptr, ref_ptr + nelems);
+
+    impl::scratchpad_arena_stats_t before, after;
+    ASSERT_EQ(impl::get_scratchpad_arena_stats(&before), impl::status::success);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n_streams; i++)
+        threads.emplace_back([&, i]() {
+            for (int iter = 0; iter < n_iters; iter++)
+                execute(i);
+        });
+    for (auto &t : threads)
+        t.join();
+
+    for (int i = 0; i < n_streams; i++) {
+        const auto *ptr
+                = static_cast<const float *>(dsts[i].get_data_handle());
+        for (size_t j = 0; j < nelems; j++)
+            ASSERT_EQ(ptr[j], ref[j]) << "stream " << i << " index " << j;
+    }
+
+    // The executions reused the scratchpads the streams already had.
+    ASSERT_EQ(impl::get_scratchpad_arena_stats(&after), impl::status::success);
+    ASSERT_EQ(after.hits + after.misses, before.hits + before.misses);
+}
+
 } // namespace dnnl
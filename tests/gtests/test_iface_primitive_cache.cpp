@@ -116,6 +116,52 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestCapacityInBytes) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+    set_primitive_cache_capacity_in_bytes(0);
+    ASSERT_EQ(get_primitive_cache_capacity_in_bytes(), 0u);
+
+    fill_primitive_cache(8);
+    size_t size_in_bytes = 0;
+    ASSERT_EQ(impl::get_primitive_cache_size_in_bytes(&size_in_bytes),
+            impl::status::success);
+
+    // A limit that is greater than the current size keeps all the entries.
+    set_primitive_cache_capacity_in_bytes(size_in_bytes + 1);
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+
+    if (size_in_bytes > 0) {
+        // The eviction makes the cache fit the limit.
+        set_primitive_cache_capacity_in_bytes(size_in_bytes / 2);
+        ASSERT_LT(get_primitive_cache_size(), 8);
+        ASSERT_EQ(impl::get_primitive_cache_size_in_bytes(&size_in_bytes),
+                impl::status::success);
+        ASSERT_LE(size_in_bytes, get_primitive_cache_capacity_in_bytes());
+    }
+    set_primitive_cache_capacity_in_bytes(0);
+}
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(2);
+
+    impl::cache_stats_t before, after;
+    ASSERT_EQ(impl::get_primitive_cache_stats(&before), impl::status::success);
+    fill_primitive_cache(1);
+    fill_primitive_cache(1);
+    ASSERT_EQ(impl::get_primitive_cache_stats(&after), impl::status::success);
+
+    ASSERT_EQ(after.hits + after.misses - before.hits - before.misses, 2u);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        // Regular CPU engines are always considered equal.
+        ASSERT_EQ(after.misses - before.misses, 1u);
+        ASSERT_EQ(after.hits - before.hits, 1u);
+    }
+#endif
+}
 #endif
 
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2024 Intel Corporation
+* Copyright 2020-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -103,4 +103,72 @@ TEST(primitive_cache_mt_test, TestMTCacheHit) {
     ASSERT_EQ(get_primitive_cache_size(), n_primitives);
 }
 
+TEST(primitive_cache_mt_test, TestAsyncCreation) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+
+    // Flush the cache
+    dnnl::set_primitive_cache_capacity(0);
+    dnnl::set_primitive_cache_capacity(1024);
+
+    int n_primitives = 10;
+
+    // Each shape is requested twice, the second request must be served by
+    // the creation started by the first one.
+    std::vector<primitive_create_request> requests;
+    for (int i = 0; i < 2 * n_primitives; i++) {
+        auto md = memory::desc(
+                {{i % n_primitives, 1, 1, 1}, dt::f32, tag::nchw});
+        auto relu_pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f);
+        requests.emplace_back(relu_pd);
+    }
+
+    for (const auto &r : requests) {
+        auto p = r.get_primitive();
+        ASSERT_TRUE(r.is_ready());
+        ASSERT_EQ(p.get_kind(), primitive::kind::eltwise);
+        // The request keeps the result, so it can be retrieved again.
+        ASSERT_EQ(r.get_primitive().get(), p.get());
+    }
+
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+}
+
+TEST(primitive_cache_mt_test, TestAsyncCreationSharesSyncPrimitives) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+
+    // Flush the cache
+    dnnl::set_primitive_cache_capacity(0);
+    dnnl::set_primitive_cache_capacity(1024);
+
+    int n_primitives = 10;
+
+    std::vector<eltwise_forward::primitive_desc> pds;
+    for (int i = 0; i < n_primitives; i++) {
+        auto md = memory::desc({{i, 1, 1, 1}, dt::f32, tag::nchw});
+        pds.emplace_back(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f);
+        eltwise_forward sync_p(pds.back());
+    }
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+
+    // The creation threads use the threading context of this thread, so the
+    // requests find the primitives created synchronously. There are more
+    // requests than creation threads.
+    std::vector<primitive_create_request> requests;
+    for (const auto &pd : pds)
+        requests.emplace_back(pd);
+    for (const auto &r : requests)
+        ASSERT_EQ(r.get_primitive().get_kind(), primitive::kind::eltwise);
+
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+}
+
 } // namespace dnnl
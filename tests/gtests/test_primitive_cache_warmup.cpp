@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/primitive_cache.hpp"
+
+namespace {
+const char *record_path = "primitive_cache_warmup_record.txt";
+
+// The manifest path is read once, at the first primitive creation, hence it is
+// set before any test runs.
+const bool is_record_path_set = [] {
+    std::remove(record_path);
+#ifdef _WIN32
+    return _putenv_s("ONEDNN_PRIMITIVE_CACHE_RECORD", record_path) == 0;
+#else
+    return ::setenv("ONEDNN_PRIMITIVE_CACHE_RECORD", record_path, 1) == 0;
+#endif
+}();
+
+std::vector<std::string> read_lines(const char *path) {
+    std::vector<std::string> lines;
+    std::ifstream ifs(path);
+    std::string line;
+    while (std::getline(ifs, line))
+        lines.push_back(line);
+    return lines;
+}
+} // namespace
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+TEST(primitive_cache_warmup_test, TestRecordAndReplay) {
+    ASSERT_TRUE(is_record_path_set);
+    engine eng(get_test_engine_kind(), 0);
+
+    auto create_primitives = [&]() {
+        const memory::dim M = 4, K = 32, N = 16;
+        matmul(matmul::primitive_desc(eng, {{M, K}, dt::f32, tag::ab},
+                {{K, N}, dt::f32, tag::ab}, {{M, N}, dt::f32, tag::ab}));
+
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        inner_product_forward(inner_product_forward::primitive_desc(eng,
+                prop_kind::forward_inference, {{M, K}, dt::f32, tag::ab},
+                {{N, K}, dt::f32, tag::ab}, {{M, N}, dt::f32, tag::ab},
+                attr));
+    };
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+    const size_t n_records = read_lines(record_path).size();
+    create_primitives();
+    ASSERT_EQ(read_lines(record_path).size(), n_records + 2);
+
+    // A primitive evicted and created again is recorded once.
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+    create_primitives();
+    ASSERT_EQ(read_lines(record_path).size(), n_records + 2);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+    ASSERT_EQ(primitive_cache_warmup(eng, record_path), (int)n_records + 2);
+
+    // The replayed primitives are fetched from the cache.
+    impl::cache_stats_t before, after;
+    ASSERT_EQ(impl::get_primitive_cache_stats(&before), impl::status::success);
+    create_primitives();
+    ASSERT_EQ(impl::get_primitive_cache_stats(&after), impl::status::success);
+    ASSERT_EQ(after.hits - before.hits, 2u);
+    ASSERT_EQ(after.misses - before.misses, 0u);
+}
+
+TEST(primitive_cache_warmup_test, TestCorruptedRecords) {
+    ASSERT_TRUE(is_record_path_set);
+    engine eng(get_test_engine_kind(), 0);
+
+    const char *path = "primitive_cache_warmup_test.txt";
+    std::remove(path);
+    EXPECT_ANY_THROW(primitive_cache_warmup(eng, path));
+
+    // An empty manifest is valid.
+    { std::ofstream ofs(path); }
+    ASSERT_EQ(primitive_cache_warmup(eng, path), 0);
+
+    // A shape not used by other tests to get a new record.
+    matmul(matmul::primitive_desc(eng, {{3, 5}, dt::f32, tag::ab},
+            {{5, 7}, dt::f32, tag::ab}, {{3, 7}, dt::f32, tag::ab}));
+    const auto records = read_lines(record_path);
+    ASSERT_FALSE(records.empty());
+    const std::string &valid = records.back();
+
+    std::string truncated = valid.substr(0, valid.size() / 2);
+    std::string modified = valid;
+    modified.back() = modified.back() == '0' ? '1' : '0';
+
+    // Corrupted records are skipped and the valid one is still replayed.
+    {
+        std::ofstream ofs(path);
+        ofs << "0123 not-a-record\n";
+        ofs << truncated << "\n";
+        ofs << modified << "\n";
+        ofs << valid << "\n";
+    }
+    ASSERT_EQ(primitive_cache_warmup(eng, path), 1);
+    std::remove(path);
+}
+#endif
+
+} // namespace dnnl
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct topk_test_params_t {
+    memory::format_tag src_format;
+    memory::format_tag dst_format;
+    algorithm aalgorithm;
+    int axis;
+    memory::dims src_dims;
+    memory::dims dst_dims;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class topk_test_t : public ::testing::TestWithParam<topk_test_params_t> {
+private:
+    topk_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits_t<data_t>::data_type;
+
+        p = ::testing::TestWithParam<topk_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // Values repeat along the axis to check that ties are resolved by the
+    // lower index.
+    static float src_value(memory::dim i) {
+        return static_cast<float>((i * 37) % 101 - 50);
+    }
+
+    void check_result(const memory &src, const memory &dst,
+            const memory &indices) const {
+        const auto src_d = src.get_desc();
+        const auto dst_d = dst.get_desc();
+        const auto indices_d = indices.get_desc();
+        const auto src_strides = src_d.get_strides();
+        const auto dst_strides = dst_d.get_strides();
+        const auto indices_strides = indices_d.get_strides();
+
+        auto src_data = map_memory<data_t>(src);
+        auto dst_data = map_memory<data_t>(dst);
+        auto indices_data = map_memory<int32_t>(indices);
+
+        const int ndims = static_cast<int>(p.src_dims.size());
+        const memory::dim axis_size = p.src_dims[p.axis];
+        const memory::dim k = p.dst_dims[p.axis];
+        const bool is_max = p.aalgorithm == algorithm::topk_max;
+
+        memory::dims row_dims = p.dst_dims;
+        row_dims[p.axis] = 1;
+        memory::dim nrows = 1;
+        for (auto d : row_dims)
+            nrows *= d;
+
+        std::vector<std::pair<float, memory::dim>> row(axis_size);
+        for (memory::dim r = 0; r < nrows; ++r) {
+            memory::dims pos(ndims);
+            memory::dim rem = r;
+            for (int d = ndims - 1; d >= 0; --d) {
+                pos[d] = rem % row_dims[d];
+                rem /= row_dims[d];
+            }
+            const auto offset = [&](const memory::dims &strides) {
+                memory::dim off = 0;
+                for (int d = 0; d < ndims; ++d)
+                    off += pos[d] * strides[d];
+                return off;
+            };
+
+            for (memory::dim i = 0; i < axis_size; ++i) {
+                pos[p.axis] = i;
+                row[i] = {static_cast<float>(src_data[offset(src_strides)]),
+                        i};
+            }
+            std::stable_sort(row.begin(), row.end(),
+                    [&](const std::pair<float, memory::dim> &a,
+                            const std::pair<float, memory::dim> &b) {
+                        return is_max ? a.first > b.first : a.first < b.first;
+                    });
+
+            for (memory::dim i = 0; i < k; ++i) {
+                pos[p.axis] = i;
+                ASSERT_EQ(static_cast<float>(dst_data[offset(dst_strides)]),
+                        row[i].first);
+                ASSERT_EQ(indices_data[offset(indices_strides)], row[i].second);
+            }
+        }
+    }
+
+    void Test() {
+        using pd_t = topk::primitive_desc;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        auto desc_src = memory::desc(p.src_dims, data_dt, p.src_format);
+        auto desc_dst = memory::desc(p.dst_dims, data_dt, p.dst_format);
+        auto desc_indices
+                = memory::desc(p.dst_dims, memory::data_type::s32, p.dst_format);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, desc_indices, p.axis);
+
+        EXPECT_ANY_THROW(topk(pd, {}));
+        // default primitive ctor
+        auto prim = topk();
+        // regular primitive ctor
+        prim = topk(pd);
+
+        const auto src_desc = pd.src_desc();
+        const auto dst_desc = pd.dst_desc();
+        const auto indices_desc = pd.indices_desc();
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST_INDICES)
+                == indices_desc);
+        ASSERT_EQ(indices_desc.get_data_type(), memory::data_type::s32);
+
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(src_desc, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_indices = memory(indices_desc, test_engine);
+
+        {
+            auto src_data = map_memory<data_t>(mem_src);
+            const memory::dim n = src_desc.get_size() / sizeof(data_t);
+            for (memory::dim i = 0; i < n; ++i)
+                src_data[i] = static_cast<data_t>(src_value(i));
+        }
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst},
+                        {DNNL_ARG_DST_INDICES, mem_indices}});
+        strm.wait();
+
+        check_result(mem_src, mem_dst, mem_indices);
+    }
+};
+
+using tag = memory::format_tag;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // k is greater than the axis size
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_max, 1,
+                    {2, 4}, {2, 8}, true, dnnl_invalid_arguments},
+            // k is zero
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_max, 1,
+                    {2, 4}, {2, 0}, true, dnnl_invalid_arguments},
+            // a dimension other than the axis differs
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_max, 1,
+                    {2, 4}, {1, 2}, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            topk_test_params_t {tag::ab, tag::ab, algorithm::reduction_max, 1,
+                    {2, 4}, {2, 2}, true, dnnl_invalid_arguments},
+            // bad axis
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_max, 2,
+                    {2, 4}, {2, 2}, true, dnnl_invalid_arguments},
+            // invalid tag
+            topk_test_params_t {tag::any, tag::ab, algorithm::topk_max, 1,
+                    {2, 4}, {2, 2}, true, dnnl_invalid_arguments});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(topk_test_params_t {tag::ab, tag::ab,
+            algorithm::topk_max, 1, {0, 4}, {0, 2}});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            // argmax
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_max, 1,
+                    {3, 17}, {3, 1}},
+            topk_test_params_t {tag::ab, tag::any, algorithm::topk_min, 1,
+                    {3, 17}, {3, 4}},
+            topk_test_params_t {tag::nchw, tag::nchw, algorithm::topk_max, 3,
+                    {2, 3, 4, 100}, {2, 3, 4, 7}},
+            topk_test_params_t {tag::nchw, tag::nchw, algorithm::topk_min, 1,
+                    {2, 8, 3, 5}, {2, 3, 3, 5}},
+            topk_test_params_t {tag::nhwc, tag::nhwc, algorithm::topk_max, 1,
+                    {2, 40, 3, 5}, {2, 5, 3, 5}},
+            topk_test_params_t {tag::abc, tag::abc, algorithm::topk_max, 2,
+                    {2, 3, 5}, {2, 3, 5}});
+};
+
+static auto long_rows = []() {
+    return ::testing::Values(
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_max, 1,
+                    {2, 50000}, {2, 40}},
+            topk_test_params_t {tag::ab, tag::ab, algorithm::topk_min, 1,
+                    {1, 131072}, {1, 5}});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsTopk) {} \
+    INSTANTIATE_TEST_SUITE_P(TestTopkEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopkZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopkSimple, test, simple_cases()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopkLong, test, long_rows());
+
+using topk_test_f32 = topk_test_t<float>;
+using topk_test_bf16 = topk_test_t<bfloat16_t>;
+using topk_test_f16 = topk_test_t<float16_t>;
+using topk_test_s8 = topk_test_t<int8_t>;
+
+INST_TEST_CASE(topk_test_f32)
+INST_TEST_CASE(topk_test_bf16)
+INST_TEST_CASE(topk_test_f16)
+INST_TEST_CASE(topk_test_s8)
+
+} // namespace dnnl
@@ -150,6 +150,23 @@ public:
 } // namespace testing
 } // namespace dnnl
 
+#elif defined(DNNL_TEST_THREADPOOL_USE_NATIVE)
+#include "src/common/native_threadpool.hpp"
+
+namespace dnnl {
+namespace testing {
+
+class threadpool_t : public impl::native_threadpool_t {
+public:
+    explicit threadpool_t(int num_threads = 0)
+        : impl::native_threadpool_t(num_threads > 0
+                        ? num_threads
+                        : read_num_threads_from_env()) {}
+};
+
+} // namespace testing
+} // namespace dnnl
+
 #elif defined(DNNL_TEST_THREADPOOL_USE_TBB)
 #include "tbb/parallel_for.h"
 #include "tbb/task_arena.h"